@@ -0,0 +1,74 @@
+#include "aiPolicy.h"
+#include <algorithm>
+#include <cstring>
+
+uint32_t AIConfig::id() const {
+    const float fields[] = {foldThreshold, raiseThreshold, aggressiveness, bluffCallChance};
+    uint32_t hash = 2166136261u; // FNV-1a over the bit patterns
+    for (float field : fields) {
+        uint32_t bits;
+        std::memcpy(&bits, &field, sizeof(bits));
+        for (int shift = 0; shift < 32; shift += 8) hash = (hash ^ ((bits >> shift) & 0xFF)) * 16777619u;
+    }
+    return hash ? hash : 1;
+}
+
+float AIPolicy::foldThreshold(const AIConfig& config, int amountToCall, size_t boardCards, int stack, Rng& rng) {
+    float current = config.foldThreshold + config.aggressiveness;
+
+    if (boardCards > 0 && amountToCall > 0 && stack > 0) {
+        const float betToStackRatio = static_cast<float>(amountToCall) / stack;
+
+        float increase = 0.0f;
+        if (betToStackRatio > 0.5f) {
+            increase = 0.2f;
+        } else if (betToStackRatio > 0.25f) {
+            increase = 0.1f;
+        }
+
+        if (increase > 0.0f && rng.nextDouble() < config.bluffCallChance)
+            increase *= static_cast<float>(rng.nextDouble()) * 0.7f; // Less cautious this time
+
+        current = std::min(current + increase, 0.9f);
+    }
+
+    return current;
+}
+
+Action AIPolicy::respondToBet(const AIConfig& config, double winChance,
+                              int amountToCall, int stack, int opponentBet, int pot,
+                              size_t boardCards, Rng& rng) {
+    Action action;
+    if (amountToCall <= 0) return action; // Stakes are even: check
+
+    const float foldBelow = foldThreshold(config, amountToCall, boardCards, stack, rng);
+    const float raiseAbove = config.raiseThreshold + config.aggressiveness;
+    const int callPart = std::min(amountToCall, stack);
+
+    if (winChance < foldBelow && stack > amountToCall) {
+        action.type = Action::Type::Fold;
+    } else if (winChance < raiseAbove || amountToCall >= stack) {
+        action.type = Action::Type::Call;
+        action.amount = callPart;
+    } else {
+        const int canRaiseMax = stack - callPart;
+        int raisePart = std::min({opponentBet, pot / 2, canRaiseMax});
+        if (raisePart <= 0) raisePart = std::min(50, canRaiseMax); // Ensure some raise if possible
+        action.type = raisePart > 0 ? Action::Type::Raise : Action::Type::Call;
+        action.amount = callPart + std::max(raisePart, 0);
+    }
+    return action;
+}
+
+Action AIPolicy::respondToCheck(const AIConfig& config, double winChance, int stack, int pot) {
+    Action action;
+    if (winChance > config.raiseThreshold + config.aggressiveness && stack > 0) {
+        int betAmount = std::min(pot / 2, stack / 2);
+        if (betAmount <= 0) betAmount = std::min(50, stack);
+        if (betAmount > 0) {
+            action.type = Action::Type::Bet;
+            action.amount = betAmount;
+        }
+    }
+    return action;
+}
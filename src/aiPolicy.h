@@ -0,0 +1,39 @@
+#ifndef AIPOLICY_H
+#define AIPOLICY_H
+
+#include <cstddef>
+#include <cstdint>
+#include "gameState.h"
+#include "rng.h"
+
+// Tunable knobs of the computer player. Every threshold is a win probability
+// and is shifted by aggressiveness, so a negative value plays tighter.
+struct AIConfig {
+    float foldThreshold = 0.35f;   // Facing a bet, fold below this
+    float raiseThreshold = 0.55f;  // Raise a bet, or bet after a check, above this
+    float aggressiveness = 0.0f;   // Added to both thresholds
+    float bluffCallChance = 0.3f;  // Chance to shrink the extra caution against a big bet
+
+    // Nonzero hash of the settings, stored per seat in hand records so a log
+    // can be split by configuration; HandRecord::HUMAN (0) marks a person
+    uint32_t id() const;
+};
+
+// Betting decisions of the computer player, shared by the game and poker_selfplay.
+// Pure functions of the situation; the only randomness comes from rng.
+class AIPolicy {
+public:
+    // Fold threshold stretched up to +0.2 when the call is a large part of the
+    // stack after the flop; with bluffCallChance only part of the stretch applies
+    static float foldThreshold(const AIConfig& config, int amountToCall, size_t boardCards, int stack, Rng& rng);
+
+    // The opponent has bet opponentBet this street and we need amountToCall more
+    static Action respondToBet(const AIConfig& config, double winChance,
+                               int amountToCall, int stack, int opponentBet, int pot,
+                               size_t boardCards, Rng& rng);
+
+    // Nothing to call: bet half the pot (at most half the stack) or check
+    static Action respondToCheck(const AIConfig& config, double winChance, int stack, int pot);
+};
+
+#endif // AIPOLICY_H
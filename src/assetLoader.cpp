@@ -0,0 +1,69 @@
+#include "assetLoader.h"
+#include "threadPool.h"
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+
+namespace ui {
+
+AssetLoader::~AssetLoader() {
+    if (done_.valid()) done_.wait();
+}
+
+void AssetLoader::start(const std::string& cardDirectory, float cardScale,
+                        std::vector<std::string> fontPaths, ThreadPool& pool) {
+    if (done_.valid()) throw std::logic_error("AssetLoader already started");
+    cardScale_ = cardScale;
+    maxTextureSize_ = sf::Texture::getMaximumSize(); // Not on a worker: SFML 2 creates a GL context for it
+
+    auto promise = std::make_shared<std::promise<void>>();
+    done_ = promise->get_future();
+    pool.submit([this, promise, cardDirectory, fontPaths = std::move(fontPaths), &pool]() {
+        try {
+            run(cardDirectory, fontPaths, pool);
+            promise->set_value();
+        } catch (...) {
+            promise->set_exception(std::current_exception());
+        }
+    });
+}
+
+void AssetLoader::run(const std::string& cardDirectory, const std::vector<std::string>& fontPaths,
+                      ThreadPool& pool) {
+    for (const std::string& path : fontPaths) {
+        if (font_.loadFromFile(path)) {
+            fontLoaded_ = true;
+            break;
+        }
+    }
+
+    const std::string cachePath = CardAtlas::cachePath();
+    if (CardAtlas::readCache(cachePath, cardDirectory, cardScale_, atlas_)) {
+        atlasFromCache_ = true;
+        imagesDone_ = CardAtlas::NUM_IMAGES;
+        return;
+    }
+    if (CardAtlas::decode(cardDirectory, cardScale_, maxTextureSize_, atlas_, &pool, &imagesDone_))
+        CardAtlas::writeCache(cachePath, cardDirectory, cardScale_, atlas_); // Best effort, like the evaluator tables
+}
+
+float AssetLoader::progress() const {
+    if (ready()) return 1.f;
+    return static_cast<float>(imagesDone_.load()) / CardAtlas::NUM_IMAGES;
+}
+
+bool AssetLoader::ready() const {
+    return done_.valid() && done_.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+bool AssetLoader::finish(CardAtlas& cardAtlas, sf::Font& font) {
+    if (!done_.valid()) throw std::logic_error("AssetLoader not started");
+    done_.get();
+    cardAtlas.upload(atlas_, cardScale_);
+    atlas_ = CardAtlasImage(); // The texture holds the pixels now
+    if (!fontLoaded_) return false;
+    font = font_;
+    return true;
+}
+
+} // namespace ui
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <atomic>
+#include <future>
+#include <string>
+#include <vector>
+#include "cardAtlas.h"
+
+class ThreadPool;
+
+namespace ui {
+
+// Startup assets prepared in the background while the window opens: the card
+// atlas (from its disk cache when fresh, else decoded from the PNGs on the
+// pool) and the first font of a list of candidates that loads. The main thread
+// draws a loading bar from progress() and calls finish() once ready(), so no
+// frame waits on file I/O.
+class AssetLoader {
+public:
+    AssetLoader() = default;
+    ~AssetLoader(); // Waits for work still running
+
+    AssetLoader(const AssetLoader&) = delete;
+    AssetLoader& operator=(const AssetLoader&) = delete;
+
+    // Once per loader, on the main thread: it queries the maximum texture
+    // size, which needs a GL context, before handing off. The atlas cache
+    // lives at CardAtlas::cachePath().
+    void start(const std::string& cardDirectory, float cardScale,
+               std::vector<std::string> fontPaths, ThreadPool& pool);
+
+    float progress() const; // 0..1
+    bool ready() const;     // Never blocks
+
+    // Main thread; blocks until ready. Uploads the atlas into cardAtlas (check
+    // isLoaded(); blank cards if the images were missing) and hands over the
+    // font. False if no font could be loaded.
+    bool finish(CardAtlas& cardAtlas, sf::Font& font);
+
+    bool atlasFromCache() const { return atlasFromCache_; }
+
+private:
+    void run(const std::string& cardDirectory, const std::vector<std::string>& fontPaths, ThreadPool& pool);
+
+    float cardScale_ = 1.f;
+    unsigned maxTextureSize_ = 0;
+    std::atomic<int> imagesDone_{0};
+    std::future<void> done_;
+
+    // Written by the background task, read after done_
+    CardAtlasImage atlas_;
+    sf::Font font_;
+    bool fontLoaded_ = false;
+    bool atlasFromCache_ = false;
+};
+
+} // namespace ui
@@ -1,8 +1,5 @@
 #pragma once
 #include <string>
-#include <SFML/Graphics.hpp>
-#include <SFML/Window.hpp>
-#include <SFML/System.hpp>
 #include <iostream>
 
 class Card {
@@ -22,11 +19,13 @@ public:
 
     Rank getRank() const;
     Suit getSuit() const;
+    // Dense 0..51 index: suit * 13 + (rank - 2)
+    int getIndex() const { return static_cast<int>(suit_) * 13 + static_cast<int>(rank_) - 2; }
+    static Card fromIndex(int index);
     bool isFaceUp() const;
     std::string toString() const;
     std::string toPokerStoveString() const;
     void print() const;
-    void draw(sf::RenderWindow& window, float x, float y) const;
     void setFaceUp(bool faceUp);
 
 private:
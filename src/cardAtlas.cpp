@@ -0,0 +1,257 @@
+#include "cardAtlas.h"
+#include "mappedFile.h"
+#include "threadPool.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace ui {
+
+namespace {
+
+constexpr int COLUMNS = 14; // 13 ranks, then the back
+constexpr int ROWS = 4;     // Suits in Card::Suit order
+
+const char* const SUIT_NAMES[] = {"hearts", "diamonds", "clubs", "spades"};
+const char* const RANK_NAMES[] = {"2", "3", "4", "5", "6", "7", "8", "9", "10",
+                                  "jack", "queen", "king", "ace"};
+
+// Copies the outermost pixels of the cell at (left, top) into the PADDING
+// pixels around it; only that cell's padded box is written
+void extrude(std::vector<sf::Uint8>& atlas, unsigned atlasWidth, unsigned left, unsigned top,
+             unsigned cellWidth, unsigned cellHeight) {
+    const unsigned pad = CardAtlas::PADDING;
+    auto pixel = [&](unsigned x, unsigned y) { return atlas.data() + 4 * (static_cast<size_t>(y) * atlasWidth + x); };
+    for (unsigned y = top; y < top + cellHeight; ++y) {
+        for (unsigned i = 1; i <= pad; ++i) {
+            std::memcpy(pixel(left - i, y), pixel(left, y), 4);
+            std::memcpy(pixel(left + cellWidth - 1 + i, y), pixel(left + cellWidth - 1, y), 4);
+        }
+    }
+    // Whole rows, corners included
+    for (unsigned i = 1; i <= pad; ++i) {
+        std::memcpy(pixel(left - pad, top - i), pixel(left - pad, top), 4 * (cellWidth + 2 * pad));
+        std::memcpy(pixel(left - pad, top + cellHeight - 1 + i), pixel(left - pad, top + cellHeight - 1),
+                    4 * (cellWidth + 2 * pad));
+    }
+}
+
+// Box filter: every atlas pixel is the average of a shrink x shrink block of the source
+void blit(const sf::Image& image, int shrink, std::vector<sf::Uint8>& atlas, unsigned atlasWidth,
+          unsigned left, unsigned top, unsigned cellWidth, unsigned cellHeight) {
+    const sf::Vector2u size = image.getSize();
+    const sf::Uint8* pixels = image.getPixelsPtr();
+    for (unsigned y = 0; y < cellHeight; ++y) {
+        for (unsigned x = 0; x < cellWidth; ++x) {
+            unsigned sum[4] = {0, 0, 0, 0};
+            unsigned count = 0;
+            for (unsigned sy = y * shrink; sy < std::min(size.y, (y + 1) * shrink); ++sy) {
+                for (unsigned sx = x * shrink; sx < std::min(size.x, (x + 1) * shrink); ++sx) {
+                    const sf::Uint8* p = pixels + 4 * (static_cast<size_t>(sy) * size.x + sx);
+                    for (int c = 0; c < 4; ++c) sum[c] += p[c];
+                    ++count;
+                }
+            }
+            sf::Uint8* out = atlas.data() + 4 * (static_cast<size_t>(top + y) * atlasWidth + left + x);
+            for (int c = 0; c < 4; ++c) out[c] = static_cast<sf::Uint8>((sum[c] + count / 2) / count);
+        }
+    }
+}
+
+constexpr uint32_t CACHE_MAGIC = 0x54414350; // "PCAT"
+constexpr uint32_t CACHE_VERSION = 2; // 2: padded cells
+
+struct CacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t stamp; // sourceStamp() of the PNG directory and display scale
+    uint32_t width, height;
+    uint32_t cellWidth, cellHeight;
+    uint32_t sourceWidth, sourceHeight;
+};
+
+// FNV-1a over the display scale and the size and modification time of every
+// source image; changes whenever one of them is replaced
+uint64_t sourceStamp(const std::string& directory, float displayScale) {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    auto mix = [&](uint64_t value) {
+        for (int i = 0; i < 8; ++i) {
+            hash ^= (value >> (8 * i)) & 0xFF;
+            hash *= 0x100000001b3ull;
+        }
+    };
+    uint32_t scaleBits;
+    std::memcpy(&scaleBits, &displayScale, sizeof(scaleBits));
+    mix(scaleBits);
+    auto addFile = [&](const std::string& path) {
+        std::error_code error;
+        const auto size = std::filesystem::file_size(path, error);
+        mix(error ? 0 : static_cast<uint64_t>(size));
+        const auto time = std::filesystem::last_write_time(path, error);
+        mix(error ? 0 : static_cast<uint64_t>(time.time_since_epoch().count()));
+    };
+    for (int suit = 0; suit < 4; ++suit) {
+        for (int rank = 0; rank < 13; ++rank)
+            addFile(directory + "/" + RANK_NAMES[rank] + "_of_" + SUIT_NAMES[suit] + ".png");
+    }
+    addFile(directory + "/revers.png");
+    return hash;
+}
+
+} // namespace
+
+bool CardAtlas::decode(const std::string& directory, float displayScale, unsigned maxTextureSize,
+                       CardAtlasImage& image, ThreadPool* pool, std::atomic<int>* progress) {
+    image = CardAtlasImage();
+
+    // The back goes first: its size fixes the cell size for every face
+    sf::Image back;
+    if (!back.loadFromFile(directory + "/revers.png")) return false;
+    const sf::Vector2u source = back.getSize();
+    if (source.x == 0 || source.y == 0) return false;
+    if (progress) ++*progress;
+
+    // Keep at least 1.25 atlas pixels per screen pixel so the linear filter has detail left to work with
+    int shrink = std::max(1, static_cast<int>(1.0f / (displayScale * 1.25f)));
+    while (((source.x + shrink - 1) / shrink + 2 * PADDING) * COLUMNS > maxTextureSize ||
+           ((source.y + shrink - 1) / shrink + 2 * PADDING) * ROWS > maxTextureSize)
+        ++shrink;
+    image.sourceWidth = source.x;
+    image.sourceHeight = source.y;
+    image.cellWidth = (source.x + shrink - 1) / shrink;
+    image.cellHeight = (source.y + shrink - 1) / shrink;
+    const unsigned strideX = image.cellWidth + 2 * PADDING, strideY = image.cellHeight + 2 * PADDING;
+    image.width = strideX * COLUMNS;
+    image.height = strideY * ROWS;
+    image.pixels.assign(4 * static_cast<size_t>(image.width) * image.height, 0);
+    blit(back, shrink, image.pixels, image.width, 13 * strideX + PADDING, PADDING, image.cellWidth, image.cellHeight);
+    extrude(image.pixels, image.width, 13 * strideX + PADDING, PADDING, image.cellWidth, image.cellHeight);
+
+    // Every face owns its own cell, so the workers never write the same pixels
+    std::atomic<bool> failed{false};
+    auto decodeFace = [&](size_t index) {
+        if (failed) return;
+        const int suit = static_cast<int>(index) / 13, rank = static_cast<int>(index) % 13;
+        sf::Image face;
+        if (!face.loadFromFile(directory + "/" + RANK_NAMES[rank] + "_of_" + SUIT_NAMES[suit] + ".png") ||
+            face.getSize() != source) {
+            failed = true;
+            return;
+        }
+        const unsigned left = rank * strideX + PADDING, top = suit * strideY + PADDING;
+        blit(face, shrink, image.pixels, image.width, left, top, image.cellWidth, image.cellHeight);
+        extrude(image.pixels, image.width, left, top, image.cellWidth, image.cellHeight);
+        if (progress) ++*progress;
+    };
+    if (pool) {
+        pool->parallelFor(52, decodeFace);
+    } else {
+        for (size_t index = 0; index < 52; ++index) decodeFace(index);
+    }
+
+    if (failed) image = CardAtlasImage();
+    return !failed;
+}
+
+bool CardAtlas::readCache(const std::string& path, const std::string& directory, float displayScale,
+                          CardAtlasImage& image) {
+    MappedFile file;
+    if (!file.open(path) || file.size() < sizeof(CacheHeader)) return false;
+    CacheHeader header;
+    std::memcpy(&header, file.data(), sizeof(header));
+    const size_t bytes = 4 * static_cast<size_t>(header.width) * header.height;
+    if (header.magic != CACHE_MAGIC || header.version != CACHE_VERSION ||
+        header.stamp != sourceStamp(directory, displayScale) || file.size() != sizeof(header) + bytes ||
+        header.width != (header.cellWidth + 2 * PADDING) * COLUMNS ||
+        header.height != (header.cellHeight + 2 * PADDING) * ROWS)
+        return false;
+
+    image.width = header.width;
+    image.height = header.height;
+    image.cellWidth = header.cellWidth;
+    image.cellHeight = header.cellHeight;
+    image.sourceWidth = header.sourceWidth;
+    image.sourceHeight = header.sourceHeight;
+    image.pixels.assign(file.data() + sizeof(header), file.data() + sizeof(header) + bytes);
+    return true;
+}
+
+void CardAtlas::writeCache(const std::string& path, const std::string& directory, float displayScale,
+                           const CardAtlasImage& image) {
+    if (image.empty()) return;
+    // Write to a temporary name first so a concurrent reader never maps a partial file
+    const std::string tmpPath = path + ".tmp";
+    {
+        std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!out) return;
+        CacheHeader header{CACHE_MAGIC, CACHE_VERSION, sourceStamp(directory, displayScale),
+                           image.width, image.height, image.cellWidth, image.cellHeight,
+                           image.sourceWidth, image.sourceHeight};
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(image.pixels.data()),
+                  static_cast<std::streamsize>(image.pixels.size()));
+        if (!out) {
+            out.close();
+            std::remove(tmpPath.c_str());
+            return;
+        }
+    }
+    std::remove(path.c_str());
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0) std::remove(tmpPath.c_str());
+}
+
+std::string CardAtlas::cachePath() {
+    const char* env = std::getenv("POKER_CARD_ATLAS");
+    if (env && *env) return env;
+    return "poker_cards.atlas";
+}
+
+bool CardAtlas::upload(const CardAtlasImage& image, float displayScale) {
+    loaded_ = false;
+    if (image.empty() || !texture_.create(image.width, image.height)) return false;
+    texture_.update(image.pixels.data());
+    texture_.setSmooth(true);
+
+    cellSize_ = sf::Vector2f(static_cast<float>(image.cellWidth), static_cast<float>(image.cellHeight));
+    cardSize_ = sf::Vector2f(image.sourceWidth * displayScale, image.sourceHeight * displayScale);
+    loaded_ = true;
+    return true;
+}
+
+bool CardAtlas::load(const std::string& directory, float displayScale) {
+    CardAtlasImage image;
+    return decode(directory, displayScale, sf::Texture::getMaximumSize(), image) && upload(image, displayScale);
+}
+
+void CardAtlas::appendCard(sf::VertexArray& vertices, int cardIndex, sf::Vector2f position) const {
+    const sf::Vector2f corners[4] = {
+        position,
+        {position.x + cardSize_.x, position.y},
+        {position.x + cardSize_.x, position.y + cardSize_.y},
+        {position.x, position.y + cardSize_.y},
+    };
+
+    sf::Vector2f uv[4];
+    if (loaded_) {
+        const int column = cardIndex == BACK ? 13 : cardIndex % 13;
+        const int row = cardIndex == BACK ? 0 : cardIndex / 13;
+        // Half a texel in from the cell edge, so filtering only reads this card and its padding
+        const float pad = static_cast<float>(PADDING);
+        const sf::Vector2f origin(column * (cellSize_.x + 2 * pad) + pad + 0.5f,
+                                  row * (cellSize_.y + 2 * pad) + pad + 0.5f);
+        const sf::Vector2f size(cellSize_.x - 1.f, cellSize_.y - 1.f);
+        uv[0] = origin;
+        uv[1] = {origin.x + size.x, origin.y};
+        uv[2] = {origin.x + size.x, origin.y + size.y};
+        uv[3] = {origin.x, origin.y + size.y};
+    }
+
+    // Without a texture the white vertex colour alone draws the card blank
+    for (int corner : {0, 1, 2, 0, 2, 3})
+        vertices.append(sf::Vertex(corners[corner], sf::Color::White, uv[corner]));
+}
+
+} // namespace ui
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class ThreadPool;
+
+namespace ui {
+
+// Decoded atlas in system memory. Building one needs no OpenGL context, so it
+// can happen on worker threads while the window opens.
+struct CardAtlasImage {
+    unsigned width = 0, height = 0;              // Atlas pixels
+    unsigned cellWidth = 0, cellHeight = 0;      // Atlas pixels per card, padding excluded
+    unsigned sourceWidth = 0, sourceHeight = 0;  // Card image size before shrinking
+    std::vector<sf::Uint8> pixels;               // RGBA rows
+
+    bool empty() const { return pixels.empty(); }
+};
+
+// All 52 card faces and the card back packed into one texture at startup, so
+// every card on the table goes into a single vertex array and one draw call.
+// Faces sit on a 14 x 4 grid: column rank - 2, row suit, back at column 13 of row 0.
+// Each cell is surrounded by PADDING pixels repeating its edge, so the linear
+// filter never blends in the neighbouring card.
+class CardAtlas {
+public:
+    static constexpr unsigned PADDING = 2; // Atlas pixels around every cell
+    static constexpr int BACK = -1;        // appendCard index of a face-down card
+    static constexpr int NUM_IMAGES = 53;  // Decode steps reported through progress
+
+    // Loads <directory>/<rank>_of_<suit>.png and revers.png. Images are shrunk
+    // by an integer factor that keeps them a little above displayScale, which
+    // keeps the atlas small, and further if the atlas would exceed
+    // maxTextureSize. Query that with sf::Texture::getMaximumSize() on the
+    // main thread: in SFML 2 the query creates a GL context. The images are
+    // decoded on pool when given, and progress (if not null) counts decoded
+    // images. False if a file is missing or the images differ in size.
+    static bool decode(const std::string& directory, float displayScale, unsigned maxTextureSize,
+                       CardAtlasImage& image, ThreadPool* pool = nullptr, std::atomic<int>* progress = nullptr);
+
+    // Pre-decoded atlas on disk, valid for the same displayScale while the PNG
+    // files keep their size and modification time. readCache is false for a
+    // missing or stale file; writeCache is best effort.
+    static bool readCache(const std::string& path, const std::string& directory, float displayScale,
+                          CardAtlasImage& image);
+    static void writeCache(const std::string& path, const std::string& directory, float displayScale,
+                           const CardAtlasImage& image);
+
+    // $POKER_CARD_ATLAS if set, else poker_cards.atlas in the working directory
+    static std::string cachePath();
+
+    // Main thread: turns a decoded atlas into the texture. On failure
+    // appendCard emits plain white cards.
+    bool upload(const CardAtlasImage& image, float displayScale);
+
+    // decode followed by upload, all on the main thread
+    bool load(const std::string& directory, float displayScale);
+
+    bool isLoaded() const { return loaded_; }
+
+    const sf::Texture* texture() const { return loaded_ ? &texture_ : nullptr; }
+    sf::Vector2f cardSize() const { return cardSize_; } // On screen
+
+    // Two triangles for the card (Card::getIndex(), or BACK) with its top-left corner at position
+    void appendCard(sf::VertexArray& vertices, int cardIndex, sf::Vector2f position) const;
+
+private:
+    sf::Texture texture_;
+    sf::Vector2f cellSize_;                 // Atlas pixels per card, padding excluded
+    sf::Vector2f cardSize_{90.f, 130.68f};  // 500 x 726 source images at 0.18
+    bool loaded_ = false;
+};
+
+} // namespace ui
@@ -0,0 +1,51 @@
+#include "cardSet.h"
+#include "hand.h"
+#include <cctype>
+#include <cstring>
+#include <stdexcept>
+
+CardSet::CardSet(const std::vector<Card>& cards) {
+    for (const auto& card : cards) add(card);
+}
+
+CardSet::CardSet(const Hand& hand) : mask_(hand.getCardSet().mask()) {}
+
+CardSet CardSet::fromPokerStoveString(const std::string& text) {
+    static const char* ranks = "23456789TJQKA";
+    static const char* suits = "hdcs"; // Card::Suit order: hearts, diamonds, clubs, spades
+
+    CardSet result;
+    size_t i = 0;
+    while (i < text.size()) {
+        if (std::isspace(static_cast<unsigned char>(text[i])) || text[i] == ',') {
+            ++i;
+            continue;
+        }
+        if (i + 1 >= text.size())
+            throw std::invalid_argument("Truncated card in \"" + text + "\"");
+        const char* rank = std::strchr(ranks, std::toupper(static_cast<unsigned char>(text[i])));
+        const char* suit = std::strchr(suits, std::tolower(static_cast<unsigned char>(text[i + 1])));
+        if (!rank || !*rank || !suit || !*suit)
+            throw std::invalid_argument("Invalid card \"" + text.substr(i, 2) + "\"");
+        result.add(static_cast<int>(suit - suits) * 13 + static_cast<int>(rank - ranks));
+        i += 2;
+    }
+    return result;
+}
+
+std::vector<Card> CardSet::toCards() const {
+    std::vector<Card> cards;
+    cards.reserve(size());
+    forEach([&](int index) { cards.push_back(Card::fromIndex(index)); });
+    return cards;
+}
+
+Hand CardSet::toHand() const {
+    return Hand(toCards());
+}
+
+std::string CardSet::toPokerStoveString() const {
+    std::string result;
+    forEach([&](int index) { result += Card::fromIndex(index).toPokerStoveString(); });
+    return result;
+}
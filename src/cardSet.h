@@ -0,0 +1,100 @@
+#ifndef CARDSET_H
+#define CARDSET_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "card.h"
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+class Hand;
+
+// Set of cards as a 52-bit mask, bit Card::getIndex() per card. Suits occupy
+// consecutive 13-bit blocks, so suitMask() is a shift and a mask.
+class CardSet {
+public:
+    static constexpr uint64_t FULL_MASK = (uint64_t(1) << 52) - 1;
+
+    constexpr CardSet() = default;
+    constexpr explicit CardSet(uint64_t mask) : mask_(mask) {}
+    explicit CardSet(const Card& card) : mask_(bit(card.getIndex())) {}
+    explicit CardSet(const std::vector<Card>& cards);
+    explicit CardSet(const Hand& hand);
+
+    // Parses concatenated PokerStove cards such as "AsKd" or "Th 9h 2c"
+    static CardSet fromPokerStoveString(const std::string& text);
+    static constexpr CardSet fullDeck() { return CardSet(FULL_MASK); }
+
+    void add(const Card& card) { mask_ |= bit(card.getIndex()); }
+    void add(int index) { mask_ |= bit(index); }
+    void remove(const Card& card) { mask_ &= ~bit(card.getIndex()); }
+    void remove(int index) { mask_ &= ~bit(index); }
+    bool contains(const Card& card) const { return (mask_ & bit(card.getIndex())) != 0; }
+    bool contains(int index) const { return (mask_ & bit(index)) != 0; }
+    bool intersects(CardSet other) const { return (mask_ & other.mask_) != 0; }
+
+    int size() const { return popcount(mask_); }
+    bool empty() const { return mask_ == 0; }
+    uint64_t mask() const { return mask_; }
+    // Ranks held in one suit, bit 0 = Two .. bit 12 = Ace
+    unsigned suitMask(int suit) const { return static_cast<unsigned>(mask_ >> (13 * suit)) & 0x1FFFu; }
+    // Cards of the full deck that are not in this set
+    CardSet complement() const { return CardSet(~mask_ & FULL_MASK); }
+
+    CardSet operator|(CardSet other) const { return CardSet(mask_ | other.mask_); }
+    CardSet operator&(CardSet other) const { return CardSet(mask_ & other.mask_); }
+    CardSet operator-(CardSet other) const { return CardSet(mask_ & ~other.mask_); }
+    CardSet& operator|=(CardSet other) { mask_ |= other.mask_; return *this; }
+    CardSet& operator&=(CardSet other) { mask_ &= other.mask_; return *this; }
+    CardSet& operator-=(CardSet other) { mask_ &= ~other.mask_; return *this; }
+    bool operator==(CardSet other) const { return mask_ == other.mask_; }
+    bool operator!=(CardSet other) const { return mask_ != other.mask_; }
+
+    // Calls fn(index) for each card, lowest index first
+    template <typename Fn>
+    void forEach(Fn&& fn) const {
+        for (uint64_t m = mask_; m; m &= m - 1) fn(lowestIndex(m));
+    }
+
+    std::vector<Card> toCards() const;
+    Hand toHand() const;
+    std::string toPokerStoveString() const;
+
+    static int popcount(uint64_t m) {
+#if defined(_MSC_VER) && !defined(__clang__)
+        return static_cast<int>(__popcnt64(m));
+#else
+        return __builtin_popcountll(m);
+#endif
+    }
+
+    static int lowestIndex(uint64_t m) {
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index;
+        _BitScanForward64(&index, m);
+        return static_cast<int>(index);
+#else
+        return __builtin_ctzll(m);
+#endif
+    }
+
+    static int highestIndex(uint64_t m) {
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index;
+        _BitScanReverse64(&index, m);
+        return static_cast<int>(index);
+#else
+        return 63 - __builtin_clzll(m);
+#endif
+    }
+
+private:
+    static constexpr uint64_t bit(int index) { return uint64_t(1) << index; }
+
+    uint64_t mask_ = 0;
+};
+
+#endif // CARDSET_H
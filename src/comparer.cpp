@@ -1,5 +1,7 @@
 #include "comparer.h"
+#include "evaluator.h"
 #include <algorithm>
+#include <stdexcept>
 
 int Comparer::getHandType(const Hand& hand)
 {
@@ -94,36 +96,60 @@ int Comparer::getHandType(const Hand& hand)
 
 int Comparer::compareHands(const Hand& hand1, const Hand& hand2)
 {
-    int type1 = getHandType(hand1);
-    int type2 = getHandType(hand2);
-    if (type1 != type2) {
-        return type1 > type2 ? 0 : 1; // 1 if hand1 wins, 0 if hand2 wins
-    }
-    // If types are the same, compare high cards
-    std::vector<Card> sortedHand1 = hand1.getSortedCards();
-    std::vector<Card> sortedHand2 = hand2.getSortedCards();
-    for (int i = sortedHand1.size() - 1; i >= 0; --i) {
-        if (sortedHand1[i].getRank() != sortedHand2[i].getRank()) {
-            return sortedHand1[i].getRank() > sortedHand2[i].getRank() ? 0 : 1;
-        }
+    return compareHands(hand1.getCardSet(), hand2.getCardSet());
+}
+
+std::vector<int> Comparer::getWinners(const Hand hands[], int numHands)
+{
+    std::vector<CardSet> sets;
+    sets.reserve(numHands);
+    for (int i = 0; i < numHands; ++i) sets.push_back(hands[i].getCardSet());
+    return getWinners(sets.data(), numHands);
+}
+
+int Comparer::compareHands(CardSet hand1, CardSet hand2)
+{
+    // Strengths are a total order over best 5-card hands, so ties are real ties
+    uint16_t strength1 = Evaluator::evaluate(hand1);
+    uint16_t strength2 = Evaluator::evaluate(hand2);
+    if (strength1 != strength2) {
+        return strength1 > strength2 ? 0 : 1; // 0 if hand1 wins, 1 if hand2 wins
     }
     return -1; // Hands are equal
 }
 
-std::vector<int> Comparer::getWinners(const Hand hands[], int numHands)
+std::vector<int> Comparer::getWinners(const CardSet hands[], int numHands)
 {
-    std::vector<int> winnerIndices = {0};
-    for (int i = 1; i < numHands; ++i) {
-        int result = compareHands(hands[winnerIndices[0]], hands[i]);
-        if (result == 0) {
+    std::vector<uint16_t> strengths(numHands);
+    Evaluator::evaluateBatch(hands, numHands, strengths.data());
+    return getWinners(strengths.data(), numHands);
+}
+
+std::vector<int> Comparer::getWinners(const uint16_t strengths[], int numHands)
+{
+    // No mask here, so any number of hands works
+    const uint16_t best = numHands > 0 ? *std::max_element(strengths, strengths + numHands) : 0;
+    std::vector<int> winnerIndices;
+    for (int i = 0; i < numHands; ++i) {
+        if (strengths[i] == best) winnerIndices.push_back(i);
+    }
+    return winnerIndices;
+}
+
+uint32_t Comparer::getWinnerMask(const uint16_t strengths[], int numHands)
+{
+    if (numHands > 32) throw std::invalid_argument("Comparer::getWinnerMask takes at most 32 hands");
+    uint32_t mask = 0;
+    uint16_t best = 0;
+    for (int i = 0; i < numHands; ++i) {
+        if (strengths[i] > best) {
             // hand i wins, clear previous winners
-            winnerIndices.clear();
-            winnerIndices.push_back(i);
-        } else if (result == -1) {
+            best = strengths[i];
+            mask = 1u << i;
+        } else if (strengths[i] == best) {
             // hands are equal, add to winners
-            winnerIndices.push_back(i);
+            mask |= 1u << i;
         }
-        // else: current winners remain
     }
-    return winnerIndices;
-}
\ No newline at end of file
+    return mask;
+}
@@ -1,15 +1,33 @@
 #ifndef COMPARER_H
 #define COMPARER_H
+#include <cstdint>
 #include <vector>
 #include <string>
 #include "hand.h"
 #include "card.h"
+#include "cardSet.h"
 
 class Comparer {
 public:
     static int getHandType(const Hand& hand);
+
+    // Hands are ranked by Evaluator, so each must hold 5 to 7 distinct cards;
+    // anything else throws std::invalid_argument (partial hands are no longer
+    // compared by high card). compareHands returns 0 if hand1 wins, 1 if hand2
+    // wins and -1 on a tie. getWinners lists every hand sharing the best
+    // strength, lowest index first, and is empty when numHands is 0.
     static int compareHands(const Hand& hand1, const Hand& hand2);
     static std::vector<int> getWinners(const Hand hands[], int numHands);
+
+    // Bitmask variants for the simulation hot path, same contract
+    static int compareHands(CardSet hand1, CardSet hand2);
+    static std::vector<int> getWinners(const CardSet hands[], int numHands);
+
+    // One pass over strengths already computed with Evaluator. The mask has
+    // bit i set for every hand sharing the best strength; it holds at most 32
+    // hands and throws std::invalid_argument for more.
+    static std::vector<int> getWinners(const uint16_t strengths[], int numHands);
+    static uint32_t getWinnerMask(const uint16_t strengths[], int numHands);
 };
 
 #endif
@@ -1,28 +1,31 @@
 #include "deck.h"
-#include <algorithm>
-#include <random>
-#include <chrono>
+#include <numeric>
+#include <utility>
+#include <stdexcept>
+#include <string>
 
-Deck::Deck() {
+Deck::Deck() : Deck(Rng::randomSeed()) {}
+
+Deck::Deck(uint64_t seed) : rng_(seed) {
+    std::iota(scratch_.begin(), scratch_.end(), uint8_t(0)); // dealLive leaves it as it found it
     reset();
 }
 
+void Deck::seed(uint64_t seed) {
+    rng_.reseed(seed);
+}
+
 void Deck::reset() {
-    cards_.clear();
-    for (int suit = 0; suit < 4; ++suit) {
-        for (int rank = 2; rank <= 14; ++rank) {
-            cards_.emplace_back(static_cast<Card::Rank>(rank), static_cast<Card::Suit>(suit));
-        }
-    }
+    std::iota(cards_.begin(), cards_.end(), uint8_t(0));
     shuffle();
     currentIndex_ = 0;
 }
 
 void Deck::shuffle() {
-    auto rng = std::default_random_engine(
-        static_cast<unsigned>(std::chrono::system_clock::now().time_since_epoch().count())
-    );
-    std::shuffle(cards_.begin(), cards_.end(), rng);
+    // Fisher-Yates with our own bounded draw, so a seed deals the same cards on every platform
+    for (size_t i = cards_.size(); i > 1; --i) {
+        std::swap(cards_[i - 1], cards_[rng_.below(static_cast<uint32_t>(i))]);
+    }
     currentIndex_ = 0;
 }
 
@@ -32,9 +35,65 @@ bool Deck::isEmpty() const {
 
 Card Deck::draw() {
     if (isEmpty()) throw std::out_of_range("Deck is empty");
-    return cards_[currentIndex_++];
+    return Card::fromIndex(cards_[currentIndex_++]);
 }
 
 size_t Deck::size() const {
     return cards_.size() - currentIndex_;
-}
\ No newline at end of file
+}
+
+CardSet Deck::remaining() const {
+    CardSet set;
+    for (size_t i = currentIndex_; i < cards_.size(); ++i) set.add(cards_[i]);
+    return set;
+}
+
+template <typename Emit>
+void Deck::dealLive(CardSet dead, int k, Rng& rng, Emit&& emit) {
+    const int numDead = dead.size();
+    if (k < 0 || k > 52 - numDead)
+        throw std::invalid_argument("Cannot deal " + std::to_string(k) + " cards with " +
+                                    std::to_string(numDead) + " dead");
+    // scratch_ is the identity between calls. Each swap is logged and taken
+    // back at the end, so the cards depend only on the Rng state and the cost
+    // stays O(|dead| + k) instead of a 52-entry refill.
+    uint8_t swaps[52]; // Dead cards first, then one pick per card dealt; at most 52 in all
+
+    // Dead cards to the tail, highest first: each is still at its own index
+    // because every earlier swap touched only higher positions
+    int live = 52;
+    for (uint64_t m = dead.mask(); m;) {
+        const int card = CardSet::highestIndex(m);
+        m &= ~(uint64_t(1) << card);
+        swaps[52 - live] = static_cast<uint8_t>(card);
+        std::swap(scratch_[card], scratch_[--live]);
+    }
+    // Partial Fisher-Yates over the live prefix: every pick is a live card
+    for (int i = 0; i < k; ++i) {
+        const int j = i + static_cast<int>(rng.below(static_cast<uint32_t>(live - i)));
+        swaps[numDead + i] = static_cast<uint8_t>(j);
+        std::swap(scratch_[i], scratch_[j]);
+        emit(scratch_[i]);
+    }
+
+    for (int i = k - 1; i >= 0; --i) std::swap(scratch_[i], scratch_[swaps[numDead + i]]);
+    for (int d = numDead - 1; d >= 0; --d) std::swap(scratch_[swaps[d]], scratch_[51 - d]);
+}
+
+void Deck::dealExcluding(CardSet dead, int k, int* out) {
+    dealExcluding(dead, k, out, rng_);
+}
+
+void Deck::dealExcluding(CardSet dead, int k, int* out, Rng& rng) {
+    dealLive(dead, k, rng, [&](int index) { *out++ = index; });
+}
+
+CardSet Deck::dealExcluding(CardSet dead, int k) {
+    return dealExcluding(dead, k, rng_);
+}
+
+CardSet Deck::dealExcluding(CardSet dead, int k, Rng& rng) {
+    CardSet dealt;
+    dealLive(dead, k, rng, [&](int index) { dealt.add(index); });
+    return dealt;
+}
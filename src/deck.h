@@ -1,10 +1,17 @@
 #pragma once
+#include <array>
+#include <cstdint>
 #include <vector>
 #include "card.h"
+#include "cardSet.h"
+#include "rng.h"
 
 class Deck {
 public:
-    Deck();
+    Deck(); // seeded from std::random_device
+    explicit Deck(uint64_t seed);
+
+    void seed(uint64_t seed); // Reproducible shuffles from here on
 
     void reset(); // Fill and shuffle the deck
     void shuffle();
@@ -12,8 +19,26 @@ public:
     Card draw(); // Draw the top card
 
     size_t size() const;
+    CardSet remaining() const; // Cards not drawn yet
+
+    // k distinct random cards that are not in dead, as Card indices in deal
+    // order, by a partial Fisher-Yates shuffle of a reusable buffer with the
+    // dead cards moved out of range first, so each of the k Rng draws lands
+    // on a live card: O(|dead| + k), no allocation. The cards depend only on
+    // dead, k and the Rng state, not on earlier deals or draw()/reset().
+    // Throws std::invalid_argument if fewer than k live cards remain.
+    void dealExcluding(CardSet dead, int k, int* out);
+    void dealExcluding(CardSet dead, int k, int* out, Rng& rng);
+    // Same draw when the order does not matter, e.g. a runout
+    CardSet dealExcluding(CardSet dead, int k);
+    CardSet dealExcluding(CardSet dead, int k, Rng& rng);
 
 private:
-    std::vector<Card> cards_;
+    template <typename Emit>
+    void dealLive(CardSet dead, int k, Rng& rng, Emit&& emit);
+
+    std::array<uint8_t, 52> cards_;   // Card indices in deal order
     size_t currentIndex_;
-};
\ No newline at end of file
+    std::array<uint8_t, 52> scratch_; // Identity permutation; dealExcluding restores it after each deal
+    Rng rng_;
+};
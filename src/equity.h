@@ -0,0 +1,38 @@
+#ifndef EQUITY_H
+#define EQUITY_H
+
+#include <chrono>
+#include <cstdint>
+
+constexpr int MAX_OPPONENTS = 9; // Full ring: ten players at the table
+
+// Outcome of an equity query: how often the hand wins, ties and loses
+// against the opponents, and how the numbers were obtained.
+struct EquityResult {
+    enum class Method { MonteCarlo, Exact, PreflopTable };
+
+    double win = 0.0;
+    double tie = 0.0;
+    double lose = 0.0;
+    double tieShare = 0.0; // Pot share won through split pots: tie / 2 heads-up, less multi-way
+    uint64_t samples = 0; // Simulations run, or showdowns enumerated when exact
+    double stdError = 0.0; // Standard error of equity(); 0 when exact, offline error for the table
+    Method method = Method::MonteCarlo;
+
+    // Expected pot share: wins plus each split pot divided among its winners
+    double equity() const { return win + tieShare; }
+};
+
+// Stopping rules for Monte Carlo. Sampling runs in batches and stops after
+// the first batch that meets targetStdError, when timeBudget runs out, or at
+// maxSamples, whichever comes first. The defaults run a fixed 100000 samples.
+struct EquityOptions {
+    uint64_t maxSamples = 100000;
+    double targetStdError = 0.0;                  // 0 = no precision target
+    std::chrono::microseconds timeBudget{0};      // 0 = no deadline
+    uint32_t batchSize = 8192;                    // Samples between stopping checks
+    bool usePreflopTable = true;                  // Answer empty-board queries from PreflopTable
+    int opponents = 1;                            // Random opponent hands, 1..MAX_OPPONENTS
+};
+
+#endif // EQUITY_H
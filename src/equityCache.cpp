@@ -0,0 +1,148 @@
+#include "equityCache.h"
+#include <algorithm>
+
+namespace {
+
+// Rough heap cost of one entry: the slot plus an unordered_map node and bucket
+constexpr size_t BYTES_PER_ENTRY = sizeof(EquityCache::Key) + sizeof(EquityResult) + 64;
+
+uint64_t permuteSuits(uint64_t mask, const int perm[4]) {
+    uint64_t out = 0;
+    for (int suit = 0; suit < 4; ++suit) {
+        out |= ((mask >> (13 * suit)) & 0x1FFFull) << (13 * perm[suit]);
+    }
+    return out;
+}
+
+bool acceptable(const EquityResult& cached, const EquityOptions& options) {
+    if (cached.method != EquityResult::Method::MonteCarlo) return true;
+    if (options.targetStdError > 0.0 && cached.stdError <= options.targetStdError) return true;
+    return cached.samples >= options.maxSamples;
+}
+
+} // namespace
+
+size_t EquityCache::KeyHash::operator()(const Key& key) const {
+    uint64_t h = key.hand * 0x9E3779B97F4A7C15ull ^ (key.board + 0xBF58476D1CE4E5B9ull + (key.hand << 6));
+    h ^= static_cast<uint64_t>(key.opponents) << 59;
+    h ^= h >> 29;
+    h *= 0x94D049BB133111EBull;
+    return static_cast<size_t>(h ^ (h >> 32));
+}
+
+EquityCache::EquityCache(size_t memoryBudgetBytes) : shards_(new Shard[NUM_SHARDS]) {
+    setMemoryBudget(memoryBudgetBytes);
+}
+
+EquityCache::Key EquityCache::canonicalKey(CardSet hand, CardSet board, int opponents) {
+    // Smallest (hand, board) image over all 24 relabelings of the suits
+    int perm[4] = {0, 1, 2, 3};
+    Key best{~0ull, ~0ull, static_cast<uint32_t>(opponents)};
+    do {
+        Key candidate{permuteSuits(hand.mask(), perm), permuteSuits(board.mask(), perm), best.opponents};
+        if (candidate.hand < best.hand || (candidate.hand == best.hand && candidate.board < best.board))
+            best = candidate;
+    } while (std::next_permutation(perm, perm + 4));
+    return best;
+}
+
+EquityCache::Shard& EquityCache::shardFor(const Key& key) {
+    return shards_[(KeyHash()(key) >> 8) % NUM_SHARDS];
+}
+
+bool EquityCache::find(const Key& key, const EquityOptions& options, EquityResult& result) {
+    Shard& shard = shardFor(key);
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.index.find(key);
+        if (it != shard.index.end()) {
+            Slot& slot = shard.slots[it->second];
+            if (acceptable(slot.result, options)) {
+                slot.referenced = true;
+                result = slot.result;
+                ++hits_;
+                return true;
+            }
+        }
+    }
+    ++misses_;
+    return false;
+}
+
+void EquityCache::insert(const Key& key, const EquityResult& result) {
+    Shard& shard = shardFor(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (shard.slots.empty()) return;
+
+    auto it = shard.index.find(key);
+    if (it != shard.index.end()) {
+        Slot& slot = shard.slots[it->second];
+        slot.result = result;
+        slot.referenced = true;
+        return;
+    }
+
+    // CLOCK: sweep, clearing reference bits, until a free or unreferenced slot turns up
+    for (;;) {
+        Slot& slot = shard.slots[shard.hand];
+        const uint32_t position = static_cast<uint32_t>(shard.hand);
+        shard.hand = (shard.hand + 1) % shard.slots.size();
+        if (slot.used && slot.referenced) {
+            slot.referenced = false;
+            continue;
+        }
+        if (slot.used) {
+            shard.index.erase(slot.key);
+            ++evictions_;
+        }
+        slot.key = key;
+        slot.result = result;
+        slot.used = true;
+        slot.referenced = false;
+        shard.index.emplace(key, position);
+        ++insertions_;
+        return;
+    }
+}
+
+void EquityCache::clear() {
+    for (size_t i = 0; i < NUM_SHARDS; ++i) {
+        Shard& shard = shards_[i];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        for (auto& slot : shard.slots) slot = Slot();
+        shard.index.clear();
+        shard.hand = 0;
+    }
+}
+
+void EquityCache::setMemoryBudget(size_t bytes) {
+    budget_ = bytes;
+    const size_t perShard = bytes / BYTES_PER_ENTRY / NUM_SHARDS;
+    for (size_t i = 0; i < NUM_SHARDS; ++i) {
+        Shard& shard = shards_[i];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.slots.assign(perShard, Slot());
+        shard.index.clear();
+        shard.index.reserve(perShard);
+        shard.hand = 0;
+    }
+}
+
+size_t EquityCache::getMemoryBudget() const {
+    return budget_;
+}
+
+EquityCache::Stats EquityCache::getStats() const {
+    Stats stats;
+    stats.hits = hits_;
+    stats.misses = misses_;
+    stats.insertions = insertions_;
+    stats.evictions = evictions_;
+    for (size_t i = 0; i < NUM_SHARDS; ++i) {
+        Shard& shard = shards_[i];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        stats.entries += shard.index.size();
+        stats.capacity += shard.slots.size();
+    }
+    return stats;
+}
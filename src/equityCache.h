@@ -0,0 +1,82 @@
+#ifndef EQUITYCACHE_H
+#define EQUITYCACHE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "cardSet.h"
+#include "equity.h"
+
+// Bounded, thread-safe map from (hole cards, board, opponents) to equity. Keys are
+// normalised over the 24 suit permutations, so e.g. AhKh on Qh7d2c and
+// AsKs on Qs7c2d share one entry. Sharded; CLOCK eviction within each shard.
+class EquityCache {
+public:
+    struct Key {
+        uint64_t hand = 0;
+        uint64_t board = 0;
+        uint32_t opponents = 1;
+        bool operator==(const Key& other) const {
+            return hand == other.hand && board == other.board && opponents == other.opponents;
+        }
+    };
+
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t insertions = 0;
+        uint64_t evictions = 0;
+        size_t entries = 0;
+        size_t capacity = 0;
+    };
+
+    explicit EquityCache(size_t memoryBudgetBytes = DEFAULT_BUDGET);
+
+    static constexpr size_t DEFAULT_BUDGET = 4u << 20;
+
+    static Key canonicalKey(CardSet hand, CardSet board, int opponents = 1);
+
+    // True and fills result if a cached entry is at least as precise as options ask for
+    bool find(const Key& key, const EquityOptions& options, EquityResult& result);
+    void insert(const Key& key, const EquityResult& result);
+
+    void clear();
+    void setMemoryBudget(size_t bytes); // Drops all entries; 0 disables caching
+    size_t getMemoryBudget() const;
+    Stats getStats() const;
+
+private:
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+
+    struct Slot {
+        Key key;
+        EquityResult result;
+        bool used = false;
+        bool referenced = false;
+    };
+
+    struct Shard {
+        std::mutex mutex;
+        std::vector<Slot> slots;
+        std::unordered_map<Key, uint32_t, KeyHash> index;
+        size_t hand = 0; // CLOCK hand
+    };
+
+    Shard& shardFor(const Key& key);
+
+    static constexpr size_t NUM_SHARDS = 16;
+    std::unique_ptr<Shard[]> shards_;
+    size_t budget_ = 0;
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> misses_{0};
+    std::atomic<uint64_t> insertions_{0};
+    std::atomic<uint64_t> evictions_{0};
+};
+
+#endif // EQUITYCACHE_H
@@ -0,0 +1,570 @@
+#include "evaluator.h"
+#include "mappedFile.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define POKER_EVAL_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define POKER_TARGET(isa) // MSVC compiles any intrinsic without flags
+#else
+#define POKER_TARGET(isa) __attribute__((target(isa)))
+#endif
+#endif
+
+namespace {
+
+constexpr int NUM_RANKS = 13;
+constexpr int MAX_CARDS = 7;
+constexpr size_t FLUSH_ENTRIES = size_t(1) << NUM_RANKS; // one per 13-bit rank mask
+
+constexpr uint32_t TABLE_MAGIC = 0x4C564550; // "PEVL"
+constexpr uint32_t TABLE_VERSION = 3;
+// Zero entries after the noflush table: SIMD kernels gather 32 bits at a
+// 16-bit entry, which reads one entry past the last one
+constexpr size_t TABLE_PADDING = 2;
+
+struct TableHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t flushEntries;
+    uint32_t noflushEntries;
+    uint64_t checksum; // tableChecksum() of the entries that follow
+};
+
+// FNV-1a over the table entries, so a truncated or corrupted file is
+// regenerated instead of silently giving wrong strengths
+uint64_t tableChecksum(const uint16_t* entries, size_t count) {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(entries);
+    for (size_t i = 0; i < count * sizeof(uint16_t); ++i) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+// Perfect hash of a rank histogram (13 digits of 0..4 summing to k) onto a dense
+// index: the position of the histogram among all histograms with the same sum.
+struct QuinaryHash {
+    uint32_t contrib[NUM_RANKS][MAX_CARDS + 1][5] = {};
+    uint32_t offset[MAX_CARDS + 1] = {}; // start of the 5, 6 and 7 card sections
+    uint32_t total = 0;
+};
+
+constexpr QuinaryHash makeQuinaryHash() {
+    // ways[n][s]: histograms over n ranks with s cards in total
+    uint32_t ways[NUM_RANKS + 1][MAX_CARDS + 1] = {};
+    ways[0][0] = 1;
+    for (int n = 1; n <= NUM_RANKS; ++n) {
+        for (int s = 0; s <= MAX_CARDS; ++s) {
+            for (int d = 0; d <= 4 && d <= s; ++d) ways[n][s] += ways[n - 1][s - d];
+        }
+    }
+
+    QuinaryHash h;
+    for (int r = 0; r < NUM_RANKS; ++r) {
+        for (int rem = 0; rem <= MAX_CARDS; ++rem) {
+            uint32_t sum = 0;
+            for (int c = 0; c <= 4; ++c) {
+                h.contrib[r][rem][c] = sum;
+                if (c <= rem) sum += ways[NUM_RANKS - 1 - r][rem - c];
+            }
+        }
+    }
+    uint32_t next = 0;
+    for (int k = 5; k <= MAX_CARDS; ++k) {
+        h.offset[k] = next;
+        next += ways[NUM_RANKS][k];
+    }
+    h.total = next;
+    return h;
+}
+
+constexpr QuinaryHash QHASH = makeQuinaryHash();
+
+inline uint32_t hashCounts(const uint8_t counts[NUM_RANKS], int k) {
+    uint32_t index = QHASH.offset[k];
+    int rem = k;
+    for (int r = 0; r < NUM_RANKS; ++r) {
+        index += QHASH.contrib[r][rem][counts[r]];
+        rem -= counts[r];
+    }
+    return index;
+}
+
+// Hand categories in 5-card poker order; royal flush is just the top straight flush
+enum Category { HighCard, OnePair, TwoPair, Trips, Straight, Flush, FullHouse, Quads, StraightFlush };
+
+// Category in the top bits, then up to five kicker ranks (0 = Two .. 12 = Ace) as nibbles
+uint32_t packRaw(int category, const int* kickers, int numKickers) {
+    uint32_t raw = static_cast<uint32_t>(category) << 20;
+    for (int i = 0; i < numKickers; ++i) raw |= static_cast<uint32_t>(kickers[i]) << (16 - 4 * i);
+    return raw;
+}
+
+int topRanks(unsigned mask, int n, int* out) {
+    int found = 0;
+    for (int r = NUM_RANKS - 1; r >= 0 && found < n; --r) {
+        if (mask & (1u << r)) out[found++] = r;
+    }
+    return found;
+}
+
+int straightHigh(unsigned mask) {
+    for (int high = NUM_RANKS - 1; high >= 4; --high) {
+        unsigned run = 0x1Fu << (high - 4);
+        if ((mask & run) == run) return high;
+    }
+    const unsigned wheel = (1u << 12) | 0xFu; // A-2-3-4-5
+    if ((mask & wheel) == wheel) return 3;
+    return -1;
+}
+
+// Best 5-card value of a rank histogram, flushes ignored
+uint32_t rawFromCounts(const uint8_t counts[NUM_RANKS]) {
+    int quads = -1, trips[2] = {-1, -1}, pairs[3] = {-1, -1, -1};
+    int numTrips = 0, numPairs = 0;
+    unsigned mask = 0;
+    for (int r = NUM_RANKS - 1; r >= 0; --r) {
+        if (counts[r]) mask |= 1u << r;
+        if (counts[r] == 4 && quads < 0) quads = r;
+        else if (counts[r] == 3 && numTrips < 2) trips[numTrips++] = r;
+        else if (counts[r] == 2 && numPairs < 3) pairs[numPairs++] = r;
+    }
+
+    int k[5] = {};
+    if (quads >= 0) {
+        k[0] = quads;
+        topRanks(mask & ~(1u << quads), 1, k + 1);
+        return packRaw(Quads, k, 2);
+    }
+    if (numTrips > 0 && (numTrips > 1 || numPairs > 0)) {
+        k[0] = trips[0];
+        k[1] = std::max(trips[1], pairs[0]);
+        return packRaw(FullHouse, k, 2);
+    }
+    int high = straightHigh(mask);
+    if (high >= 0) {
+        k[0] = high;
+        return packRaw(Straight, k, 1);
+    }
+    if (numTrips > 0) {
+        k[0] = trips[0];
+        topRanks(mask & ~(1u << trips[0]), 2, k + 1);
+        return packRaw(Trips, k, 3);
+    }
+    if (numPairs >= 2) {
+        k[0] = pairs[0];
+        k[1] = pairs[1];
+        topRanks(mask & ~(1u << pairs[0]) & ~(1u << pairs[1]), 1, k + 2);
+        return packRaw(TwoPair, k, 3);
+    }
+    if (numPairs == 1) {
+        k[0] = pairs[0];
+        topRanks(mask & ~(1u << pairs[0]), 3, k + 1);
+        return packRaw(OnePair, k, 4);
+    }
+    int n = topRanks(mask, 5, k);
+    return packRaw(HighCard, k, n);
+}
+
+// Best 5-card value of the ranks held in a single suit (at least five of them)
+uint32_t rawFromFlushMask(unsigned mask) {
+    int k[5] = {};
+    int high = straightHigh(mask);
+    if (high >= 0) {
+        k[0] = high;
+        return packRaw(StraightFlush, k, 1);
+    }
+    topRanks(mask, 5, k);
+    return packRaw(Flush, k, 5);
+}
+
+int popcount13(unsigned mask) {
+    int n = 0;
+    for (; mask; mask &= mask - 1) ++n;
+    return n;
+}
+
+template <typename Fn>
+void forEachHistogram(uint8_t counts[NUM_RANKS], int rank, int remaining, Fn&& fn) {
+    if (rank == NUM_RANKS) {
+        if (remaining == 0) fn();
+        return;
+    }
+    for (int c = 0; c <= 4 && c <= remaining; ++c) {
+        counts[rank] = static_cast<uint8_t>(c);
+        forEachHistogram(counts, rank + 1, remaining - c, fn);
+    }
+    counts[rank] = 0;
+}
+
+// Fills flush[FLUSH_ENTRIES] and noflush[QHASH.total] with dense strengths
+void generateTables(uint16_t* flush, uint16_t* noflush) {
+    // Every 6/7 card result is one of the 7462 distinct 5-card hands, so ranking
+    // those gives the dense strength scale
+    std::vector<uint32_t> classes;
+    classes.reserve(Evaluator::MAX_STRENGTH);
+    uint8_t counts[NUM_RANKS] = {0};
+    forEachHistogram(counts, 0, 5, [&]() { classes.push_back(rawFromCounts(counts)); });
+    for (unsigned mask = 0; mask < FLUSH_ENTRIES; ++mask) {
+        if (popcount13(mask) == 5) classes.push_back(rawFromFlushMask(mask));
+    }
+    std::sort(classes.begin(), classes.end());
+    classes.erase(std::unique(classes.begin(), classes.end()), classes.end());
+    if (classes.size() != Evaluator::MAX_STRENGTH)
+        throw std::logic_error("Evaluator: unexpected number of hand classes");
+
+    auto strengthOf = [&](uint32_t raw) {
+        auto it = std::lower_bound(classes.begin(), classes.end(), raw);
+        return static_cast<uint16_t>(it - classes.begin() + 1);
+    };
+
+    for (unsigned mask = 0; mask < FLUSH_ENTRIES; ++mask) {
+        flush[mask] = popcount13(mask) >= 5 ? strengthOf(rawFromFlushMask(mask)) : 0;
+    }
+    for (int k = 5; k <= MAX_CARDS; ++k) {
+        forEachHistogram(counts, 0, k, [&]() {
+            noflush[hashCounts(counts, k)] = strengthOf(rawFromCounts(counts));
+        });
+    }
+}
+
+struct Tables {
+    MappedFile file;
+    std::vector<uint16_t> storage;
+    const uint16_t* flush = nullptr;
+    const uint16_t* noflush = nullptr;
+    bool mapped = false;
+};
+
+bool mapTables(Tables& t, const std::string& path) {
+    if (!t.file.open(path)) return false;
+    const size_t expected = sizeof(TableHeader) + (FLUSH_ENTRIES + QHASH.total + TABLE_PADDING) * sizeof(uint16_t);
+    if (t.file.size() != expected) {
+        t.file.close();
+        return false;
+    }
+    TableHeader header;
+    std::memcpy(&header, t.file.data(), sizeof(header));
+    if (header.magic != TABLE_MAGIC || header.version != TABLE_VERSION ||
+        header.flushEntries != FLUSH_ENTRIES || header.noflushEntries != QHASH.total) {
+        t.file.close();
+        return false;
+    }
+    const uint16_t* entries = reinterpret_cast<const uint16_t*>(t.file.data() + sizeof(TableHeader));
+    if (tableChecksum(entries, FLUSH_ENTRIES + QHASH.total + TABLE_PADDING) != header.checksum) {
+        t.file.close();
+        return false;
+    }
+    t.flush = entries;
+    t.noflush = t.flush + FLUSH_ENTRIES;
+    t.mapped = true;
+    return true;
+}
+
+void saveTables(const Tables& t, const std::string& path) {
+    // Write to a temporary name first so a concurrent reader never maps a partial file
+    const std::string tmpPath = path + ".tmp";
+    {
+        std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!out) return;
+        TableHeader header{TABLE_MAGIC, TABLE_VERSION, static_cast<uint32_t>(FLUSH_ENTRIES), QHASH.total,
+                           tableChecksum(t.storage.data(), t.storage.size())};
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(t.storage.data()),
+                  static_cast<std::streamsize>(t.storage.size() * sizeof(uint16_t)));
+        if (!out) {
+            out.close();
+            std::remove(tmpPath.c_str());
+            return;
+        }
+    }
+    std::remove(path.c_str());
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0) std::remove(tmpPath.c_str());
+}
+
+Tables loadTables() {
+    Tables t;
+    const std::string path = Evaluator::tablePath();
+    if (mapTables(t, path)) return t;
+
+    t.storage.assign(FLUSH_ENTRIES + QHASH.total + TABLE_PADDING, 0);
+    generateTables(t.storage.data(), t.storage.data() + FLUSH_ENTRIES);
+    t.flush = t.storage.data();
+    t.noflush = t.flush + FLUSH_ENTRIES;
+    saveTables(t, path); // best effort, a read-only directory just means regenerating next run
+    return t;
+}
+
+const Tables& tables() {
+    static const Tables instance = loadTables();
+    return instance;
+}
+
+inline uint16_t evaluateUnchecked(const Tables& t, uint64_t mask) {
+    const unsigned m0 = static_cast<unsigned>(mask) & 0x1FFFu, m1 = static_cast<unsigned>(mask >> 13) & 0x1FFFu;
+    const unsigned m2 = static_cast<unsigned>(mask >> 26) & 0x1FFFu, m3 = static_cast<unsigned>(mask >> 39) & 0x1FFFu;
+
+    // At most one suit can hold five of seven cards, and when it does no
+    // full house or quads is possible, so the flush entry is the answer
+    uint16_t flush = std::max(std::max(t.flush[m0], t.flush[m1]), std::max(t.flush[m2], t.flush[m3]));
+    if (flush) return flush;
+
+    uint8_t counts[NUM_RANKS];
+    for (int r = 0; r < NUM_RANKS; ++r) {
+        counts[r] = static_cast<uint8_t>(((m0 >> r) & 1u) + ((m1 >> r) & 1u) + ((m2 >> r) & 1u) + ((m3 >> r) & 1u));
+    }
+    return t.noflush[hashCounts(counts, CardSet::popcount(mask))];
+}
+
+// Batch kernels. Callers have checked every hand holds 5 to 7 cards.
+using BatchKernel = void (*)(const Tables&, const CardSet*, size_t, uint16_t*);
+
+void batchScalar(const Tables& t, const CardSet* hands, size_t count, uint16_t* strengths) {
+    for (size_t i = 0; i < count; ++i) strengths[i] = evaluateUnchecked(t, hands[i].mask());
+}
+
+#ifdef POKER_EVAL_X86
+// The vector kernels compute max(best flush entry, noflush[hash]) for every
+// lane. A hand holding a flush cannot also make quads or a full house, so
+// the flush entry wins whenever it is nonzero, with no branch.
+
+POKER_TARGET("avx2")
+void batchAvx2(const Tables& t, const CardSet* hands, size_t count, uint16_t* strengths) {
+    const int* flushBase = reinterpret_cast<const int*>(t.flush);
+    const int* noflushBase = reinterpret_cast<const int*>(t.noflush);
+    const int* contrib = reinterpret_cast<const int*>(&QHASH.contrib[0][0][0]);
+    const int* offsets = reinterpret_cast<const int*>(QHASH.offset);
+    const __m256i low16 = _mm256_set1_epi32(0xFFFF);
+    const __m256i one = _mm256_set1_epi32(1);
+
+    for (size_t base = 0; base < count; base += 8) {
+        // Split each hand into its four 13-bit suit masks; short tails repeat hand 0
+        alignas(32) int32_t suits[4][8];
+        for (int lane = 0; lane < 8; ++lane) {
+            const uint64_t mask = hands[base + lane < count ? base + lane : base].mask();
+            for (int s = 0; s < 4; ++s) suits[s][lane] = static_cast<int32_t>((mask >> (13 * s)) & 0x1FFF);
+        }
+        __m256i m[4];
+        for (int s = 0; s < 4; ++s) m[s] = _mm256_load_si256(reinterpret_cast<const __m256i*>(suits[s]));
+
+        __m256i flush = _mm256_setzero_si256();
+        for (int s = 0; s < 4; ++s)
+            flush = _mm256_max_epu32(flush, _mm256_and_si256(_mm256_i32gather_epi32(flushBase, m[s], 2), low16));
+
+        // Rank histogram, one vector per rank, and the card count per lane
+        __m256i counts[NUM_RANKS];
+        __m256i cards = _mm256_setzero_si256();
+        for (int r = 0; r < NUM_RANKS; ++r) {
+            __m256i c = _mm256_and_si256(m[0], one);
+            c = _mm256_add_epi32(c, _mm256_and_si256(m[1], one));
+            c = _mm256_add_epi32(c, _mm256_and_si256(m[2], one));
+            c = _mm256_add_epi32(c, _mm256_and_si256(m[3], one));
+            counts[r] = c;
+            cards = _mm256_add_epi32(cards, c);
+            for (int s = 0; s < 4; ++s) m[s] = _mm256_srli_epi32(m[s], 1);
+        }
+
+        // Quinary hash: offset[k] + sum of contrib[r][remaining][count]
+        __m256i index = _mm256_i32gather_epi32(offsets, cards, 4);
+        __m256i remaining = cards;
+        for (int r = 0; r < NUM_RANKS; ++r) {
+            const __m256i slot = _mm256_add_epi32(_mm256_set1_epi32(r * (MAX_CARDS + 1) * 5),
+                _mm256_add_epi32(_mm256_add_epi32(_mm256_slli_epi32(remaining, 2), remaining), counts[r]));
+            index = _mm256_add_epi32(index, _mm256_i32gather_epi32(contrib, slot, 4));
+            remaining = _mm256_sub_epi32(remaining, counts[r]);
+        }
+        const __m256i noflush = _mm256_and_si256(_mm256_i32gather_epi32(noflushBase, index, 2), low16);
+
+        alignas(32) uint32_t result[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(result), _mm256_max_epu32(flush, noflush));
+        const size_t n = std::min<size_t>(8, count - base);
+        for (size_t lane = 0; lane < n; ++lane) strengths[base + lane] = static_cast<uint16_t>(result[lane]);
+    }
+}
+
+// GCC 12's avx512fintrin.h builds every unmasked intrinsic on
+// _mm512_undefined_epi32(), which trips -Wmaybe-uninitialized once inlined
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+POKER_TARGET("avx512f")
+void batchAvx512(const Tables& t, const CardSet* hands, size_t count, uint16_t* strengths) {
+    const int* flushBase = reinterpret_cast<const int*>(t.flush);
+    const int* noflushBase = reinterpret_cast<const int*>(t.noflush);
+    const int* contrib = reinterpret_cast<const int*>(&QHASH.contrib[0][0][0]);
+    const int* offsets = reinterpret_cast<const int*>(QHASH.offset);
+    const __m512i low16 = _mm512_set1_epi32(0xFFFF);
+    const __m512i one = _mm512_set1_epi32(1);
+
+    for (size_t base = 0; base < count; base += 16) {
+        alignas(64) int32_t suits[4][16];
+        for (int lane = 0; lane < 16; ++lane) {
+            const uint64_t mask = hands[base + lane < count ? base + lane : base].mask();
+            for (int s = 0; s < 4; ++s) suits[s][lane] = static_cast<int32_t>((mask >> (13 * s)) & 0x1FFF);
+        }
+        __m512i m[4];
+        for (int s = 0; s < 4; ++s) m[s] = _mm512_load_si512(suits[s]);
+
+        __m512i flush = _mm512_setzero_si512();
+        for (int s = 0; s < 4; ++s)
+            flush = _mm512_max_epu32(flush, _mm512_and_si512(_mm512_i32gather_epi32(m[s], flushBase, 2), low16));
+
+        __m512i counts[NUM_RANKS];
+        __m512i cards = _mm512_setzero_si512();
+        for (int r = 0; r < NUM_RANKS; ++r) {
+            __m512i c = _mm512_and_si512(m[0], one);
+            c = _mm512_add_epi32(c, _mm512_and_si512(m[1], one));
+            c = _mm512_add_epi32(c, _mm512_and_si512(m[2], one));
+            c = _mm512_add_epi32(c, _mm512_and_si512(m[3], one));
+            counts[r] = c;
+            cards = _mm512_add_epi32(cards, c);
+            for (int s = 0; s < 4; ++s) m[s] = _mm512_srli_epi32(m[s], 1);
+        }
+
+        __m512i index = _mm512_i32gather_epi32(cards, offsets, 4);
+        __m512i remaining = cards;
+        for (int r = 0; r < NUM_RANKS; ++r) {
+            const __m512i slot = _mm512_add_epi32(_mm512_set1_epi32(r * (MAX_CARDS + 1) * 5),
+                _mm512_add_epi32(_mm512_add_epi32(_mm512_slli_epi32(remaining, 2), remaining), counts[r]));
+            index = _mm512_add_epi32(index, _mm512_i32gather_epi32(slot, contrib, 4));
+            remaining = _mm512_sub_epi32(remaining, counts[r]);
+        }
+        const __m512i noflush = _mm512_and_si512(_mm512_i32gather_epi32(index, noflushBase, 2), low16);
+
+        alignas(64) uint32_t result[16];
+        _mm512_store_si512(result, _mm512_max_epu32(flush, noflush));
+        const size_t n = std::min<size_t>(16, count - base);
+        for (size_t lane = 0; lane < n; ++lane) strengths[base + lane] = static_cast<uint16_t>(result[lane]);
+    }
+}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif // POKER_EVAL_X86
+
+Evaluator::SimdLevel detectLevel() {
+#ifdef POKER_EVAL_X86
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) return Evaluator::SimdLevel::Scalar;
+    __cpuid(info, 1);
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    if (!osxsave) return Evaluator::SimdLevel::Scalar;
+    const unsigned long long xcr0 = _xgetbv(0);
+    if ((xcr0 & 0x6) != 0x6) return Evaluator::SimdLevel::Scalar; // OS does not save YMM state
+    __cpuidex(info, 7, 0);
+    if ((info[1] & (1 << 16)) && (xcr0 & 0xE6) == 0xE6) return Evaluator::SimdLevel::AVX512;
+    if (info[1] & (1 << 5)) return Evaluator::SimdLevel::AVX2;
+#else
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return Evaluator::SimdLevel::AVX512;
+    if (__builtin_cpu_supports("avx2")) return Evaluator::SimdLevel::AVX2;
+#endif
+#endif
+    return Evaluator::SimdLevel::Scalar;
+}
+
+BatchKernel kernelFor(Evaluator::SimdLevel level) {
+#ifdef POKER_EVAL_X86
+    if (level == Evaluator::SimdLevel::AVX512) return batchAvx512;
+    if (level == Evaluator::SimdLevel::AVX2) return batchAvx2;
+#endif
+    (void)level;
+    return batchScalar;
+}
+
+std::atomic<int>& activeLevel() {
+    static std::atomic<int> level(static_cast<int>(Evaluator::detectSimdLevel()));
+    return level;
+}
+
+} // namespace
+
+uint16_t Evaluator::evaluate(CardSet cards) {
+    const int count = cards.size();
+    if (count < 5 || count > MAX_CARDS) throw std::invalid_argument("Evaluator needs 5 to 7 cards");
+    return evaluateUnchecked(tables(), cards.mask());
+}
+
+void Evaluator::evaluateBatch(const CardSet* hands, size_t count, uint16_t* strengths) {
+    for (size_t i = 0; i < count; ++i) {
+        const int cards = hands[i].size();
+        if (cards < 5 || cards > MAX_CARDS) throw std::invalid_argument("Evaluator needs 5 to 7 cards");
+    }
+    kernelFor(simdLevel())(tables(), hands, count, strengths);
+}
+
+Evaluator::SimdLevel Evaluator::simdLevel() {
+    return static_cast<SimdLevel>(activeLevel().load(std::memory_order_relaxed));
+}
+
+Evaluator::SimdLevel Evaluator::detectSimdLevel() {
+    static const SimdLevel detected = detectLevel();
+    return detected;
+}
+
+bool Evaluator::setSimdLevel(SimdLevel level) {
+    if (static_cast<int>(level) > static_cast<int>(detectSimdLevel())) return false;
+    activeLevel() = static_cast<int>(level);
+    return true;
+}
+
+const char* Evaluator::simdLevelName(SimdLevel level) {
+    switch (level) {
+    case SimdLevel::AVX2: return "avx2";
+    case SimdLevel::AVX512: return "avx512";
+    default: return "scalar";
+    }
+}
+
+uint16_t Evaluator::evaluate(const Card* cards, size_t count) {
+    CardSet set;
+    for (size_t i = 0; i < count; ++i) set.add(cards[i]);
+    if (static_cast<size_t>(set.size()) != count) throw std::invalid_argument("Evaluator: duplicate cards");
+    return evaluate(set);
+}
+
+uint16_t Evaluator::evaluate(const std::vector<Card>& cards) {
+    return evaluate(cards.data(), cards.size());
+}
+
+uint16_t Evaluator::evaluate(const Hand& hand) {
+    return evaluate(hand.getCardSet());
+}
+
+int Evaluator::handType(uint16_t strength) {
+    // First strength of each category: pair, two pair, trips, straight, flush,
+    // full house, quads, straight flush, royal flush
+    static const uint16_t thresholds[] = {1278, 4138, 4996, 5854, 5864, 7141, 7297, 7453, 7462};
+    int type = 0;
+    for (uint16_t t : thresholds) {
+        if (strength >= t) ++type;
+    }
+    return type;
+}
+
+std::string Evaluator::tablePath() {
+    const char* env = std::getenv("POKER_EVAL_TABLE");
+    if (env && *env) return env;
+    return "poker_eval.tbl";
+}
+
+void Evaluator::init() {
+    tables();
+}
+
+bool Evaluator::isMapped() {
+    return tables().mapped;
+}
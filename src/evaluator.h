@@ -0,0 +1,48 @@
+#ifndef EVALUATOR_H
+#define EVALUATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "card.h"
+#include "cardSet.h"
+#include "hand.h"
+
+// Table-driven hand evaluator. Any 5, 6 or 7 cards map to one strength value
+// where higher is better: 1 is 7-5-4-3-2 offsuit, 7462 is a royal flush.
+// Lookup tables are built on first use, saved to tablePath() and
+// memory-mapped from there on later runs.
+class Evaluator {
+public:
+    static constexpr uint16_t MAX_STRENGTH = 7462;
+
+    // Instruction sets for evaluateBatch
+    enum class SimdLevel { Scalar, AVX2, AVX512 };
+
+    static uint16_t evaluate(CardSet cards);
+    static uint16_t evaluate(const Card* cards, size_t count);
+    static uint16_t evaluate(const std::vector<Card>& cards);
+    static uint16_t evaluate(const Hand& hand);
+
+    // strengths[i] = evaluate(hands[i]), branch-free over 8 (AVX2) or 16
+    // (AVX-512) hands at a time. The kernel is picked from CPUID on first use.
+    static void evaluateBatch(const CardSet* hands, size_t count, uint16_t* strengths);
+    static SimdLevel simdLevel();
+    static SimdLevel detectSimdLevel();        // Best level this CPU and OS support
+    static bool setSimdLevel(SimdLevel level); // False, and no change, if unsupported
+    static const char* simdLevelName(SimdLevel level);
+
+    // Category on the Comparer::getHandType scale (0 high card .. 9 royal flush)
+    static int handType(uint16_t strength);
+
+    // $POKER_EVAL_TABLE if set, otherwise "poker_eval.tbl" in the working directory
+    static std::string tablePath();
+
+    // Builds or maps the tables now instead of on the first evaluate()
+    static void init();
+    // True if the tables were memory-mapped from tablePath() rather than generated
+    static bool isMapped();
+};
+
+#endif // EVALUATOR_H
@@ -0,0 +1,204 @@
+#include "gameState.h"
+#include "evaluator.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+GameState GameState::newHand(const Hand& hole0, const Hand& hole1, const std::vector<Card>& board,
+                             int stack0, int stack1, int blind) {
+    const CardSet holes[2] = {hole0.getCardSet(), hole1.getCardSet()};
+    const CardSet runout(board);
+    if (holes[0].size() != 2 || holes[1].size() != 2 || board.size() != 5 || runout.size() != 5 ||
+        (holes[0] | holes[1] | runout).size() != 9)
+        throw std::invalid_argument("A hand needs two hole cards per seat and five board cards, all distinct");
+    if (stack0 < 1 || stack1 < 1 || blind < 1 || stack0 > MAX_CHIPS || stack1 > MAX_CHIPS || blind > MAX_CHIPS)
+        throw std::invalid_argument("Stacks and blind must be 1.." + std::to_string(MAX_CHIPS) + " chips");
+
+    GameState state;
+    const int stacks[2] = {stack0, stack1};
+    for (int seat = 0; seat < 2; ++seat) {
+        const int posted = std::min(blind, stacks[seat]);
+        state.stacks_[seat] = stacks[seat] - posted;
+        state.committed_[seat] = posted;
+        const std::vector<Card>& cards = (seat == 0 ? hole0 : hole1).getCards();
+        state.holes_[seat][0] = static_cast<uint8_t>(cards[0].getIndex());
+        state.holes_[seat][1] = static_cast<uint8_t>(cards[1].getIndex());
+    }
+    for (int i = 0; i < 5; ++i) state.board_[i] = static_cast<uint8_t>(board[i].getIndex());
+    state.blind_ = blind;
+    if (state.stacks_[0] == 0 || state.stacks_[1] == 0) state.phase_ = static_cast<uint8_t>(Phase::Showdown);
+    return state;
+}
+
+CardSet GameState::board() const {
+    CardSet shown;
+    for (int i = 0; i < boardCards(); ++i) shown.add(board_[i]);
+    return shown;
+}
+
+CardSet GameState::hole(int seat) const {
+    CardSet cards;
+    cards.add(holes_[seat][0]);
+    cards.add(holes_[seat][1]);
+    return cards;
+}
+
+int GameState::streetStart() const {
+    for (int i = numActions_; i > 0; --i) {
+        if (history_[i - 1] & CLOSES_STREET) return i;
+    }
+    return 0;
+}
+
+int GameState::toAct() const {
+    return (numActions_ - streetStart()) & 1; // Seat 0 opens every street
+}
+
+int GameState::streetBet(int seat) const {
+    // Both seats were level when the street opened; seat 0 acted at even offsets
+    int seatZeroThisStreet = 0;
+    const int start = streetStart();
+    for (int i = start; i < numActions_; i += 2) seatZeroThisStreet += decode(history_[i]).amount;
+    return committed_[seat] - (committed_[0] - seatZeroThisStreet);
+}
+
+int GameState::toCall() const {
+    const int actor = toAct();
+    return std::max(0, committed_[1 - actor] - committed_[actor]);
+}
+
+int GameState::betsThisStreet() const {
+    int bets = 0;
+    for (int i = streetStart(); i < numActions_; ++i) {
+        const Action::Type type = decode(history_[i]).type;
+        if (type == Action::Type::Bet || type == Action::Type::Raise) ++bets;
+    }
+    return bets;
+}
+
+void GameState::addAction(ActionList& list, Action::Type type, int amount) const {
+    for (int i = 0; i < list.count; ++i) {
+        if (list.items[i].type == type && list.items[i].amount == amount) return;
+    }
+    list.items[list.count++] = Action{type, amount};
+}
+
+ActionList GameState::legalActions() const {
+    ActionList list;
+    if (isTerminal()) return list;
+
+    const int actor = toAct();
+    const int stack = stacks_[actor];
+    const int call = toCall();
+    if (call > 0) {
+        addAction(list, Action::Type::Fold, 0);
+        addAction(list, Action::Type::Call, std::min(call, stack));
+    } else {
+        addAction(list, Action::Type::Check, 0);
+    }
+
+    if (stack > call && stacks_[1 - actor] > 0 && betsThisStreet() < MAX_BETS_PER_STREET) {
+        const Action::Type type = call > 0 ? Action::Type::Raise : Action::Type::Bet;
+        const int room = stack - call;
+        const int potAfterCall = pot() + call;
+        for (int size : {blind_, potAfterCall / 2, potAfterCall, room}) {
+            if (size > 0) addAction(list, type, call + std::min(size, room));
+        }
+    }
+    return list;
+}
+
+bool GameState::isLegal(const Action& action) const {
+    if (isTerminal()) return false;
+    const int actor = toAct();
+    const int stack = stacks_[actor];
+    const int call = toCall();
+    const bool canBet = stack > call && stacks_[1 - actor] > 0 && betsThisStreet() < MAX_BETS_PER_STREET;
+
+    switch (action.type) {
+    case Action::Type::Fold:
+        return call > 0 && action.amount == 0;
+    case Action::Type::Check:
+        return call == 0 && action.amount == 0;
+    case Action::Type::Call:
+        return call > 0 && action.amount == std::min(call, stack);
+    case Action::Type::Bet:
+        return call == 0 && canBet && action.amount > 0 && action.amount <= stack;
+    case Action::Type::Raise:
+        return call > 0 && canBet && action.amount > call && action.amount <= stack;
+    }
+    return false;
+}
+
+void GameState::apply(const Action& action) {
+    if (isTerminal()) throw std::logic_error("The hand is over");
+    if (!isLegal(action)) throw std::invalid_argument("Illegal action");
+
+    const int actor = toAct();
+    const bool opensStreet = numActions_ == streetStart();
+    stacks_[actor] -= action.amount;
+    committed_[actor] += action.amount;
+
+    // The betting cap keeps every hand within MAX_ACTIONS
+    const bool closesStreet = action.type == Action::Type::Call ||
+                              (action.type == Action::Type::Check && !opensStreet);
+    history_[numActions_++] = encode(action, closesStreet);
+
+    if (action.type == Action::Type::Fold) {
+        phase_ = static_cast<uint8_t>(Phase::Folded);
+    } else if (closesStreet) {
+        if (street_ == 3 || stacks_[0] == 0 || stacks_[1] == 0)
+            phase_ = static_cast<uint8_t>(Phase::Showdown); // All in: the rest of the board just runs out
+        else
+            ++street_;
+    }
+}
+
+void GameState::undo() {
+    if (numActions_ == 0) throw std::logic_error("No action to undo");
+    const uint32_t entry = history_[--numActions_];
+    history_[numActions_] = 0; // Undone states compare equal to their snapshot byte for byte
+    const Action action = decode(entry);
+
+    if (phase() == Phase::Folded) {
+        phase_ = static_cast<uint8_t>(Phase::Betting);
+    } else if (entry & CLOSES_STREET) {
+        if (phase() == Phase::Showdown) phase_ = static_cast<uint8_t>(Phase::Betting);
+        else --street_;
+    }
+
+    const int actor = toAct();
+    stacks_[actor] += action.amount;
+    committed_[actor] -= action.amount;
+}
+
+Action GameState::action(int i) const {
+    return decode(history_[i]);
+}
+
+int GameState::winnings(int seat) const {
+    if (phase() == Phase::Folded) {
+        const int folder = (numActions_ - 1 - streetStart()) & 1;
+        return seat == folder ? 0 : pot();
+    }
+    if (phase() != Phase::Showdown) return 0;
+
+    CardSet runout;
+    for (uint8_t card : board_) runout.add(card);
+    const uint16_t mine = Evaluator::evaluate(hole(seat) | runout);
+    const uint16_t theirs = Evaluator::evaluate(hole(1 - seat) | runout);
+    const int matched = std::min(committed_[0], committed_[1]);
+    const int unmatched = committed_[seat] - matched;
+    if (mine > theirs) return 2 * matched + unmatched;
+    if (mine < theirs) return unmatched;
+    return matched + unmatched;
+}
+
+uint32_t GameState::encode(const Action& action, bool closesStreet) {
+    return static_cast<uint32_t>(action.type) | (closesStreet ? CLOSES_STREET : 0u) |
+           (static_cast<uint32_t>(action.amount) << 4);
+}
+
+Action GameState::decode(uint32_t entry) {
+    return Action{static_cast<Action::Type>(entry & 7u), static_cast<int>(entry >> 4)};
+}
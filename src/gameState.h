@@ -0,0 +1,114 @@
+#ifndef GAMESTATE_H
+#define GAMESTATE_H
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+#include "card.h"
+#include "cardSet.h"
+#include "hand.h"
+
+// A betting action. amount is the chips the actor adds to the pot
+// (call part included for a raise); 0 for fold and check.
+struct Action {
+    enum class Type : uint8_t { Fold, Check, Call, Bet, Raise };
+    Type type = Type::Check;
+    int amount = 0;
+};
+
+// Fixed-capacity result of GameState::legalActions; never allocates
+struct ActionList {
+    static constexpr int CAPACITY = 6;
+    Action items[CAPACITY];
+    int count = 0;
+
+    int size() const { return count; }
+    const Action& operator[](int i) const { return items[i]; }
+    const Action* begin() const { return items; }
+    const Action* end() const { return items + count; }
+};
+
+// One heads-up hand as a 128-byte trivially copyable value: copying it is the
+// snapshot, apply() and undo() walk the game tree without touching the heap.
+// Rules follow the game: both players post the blind, seat 0 acts first on
+// every street, and at most MAX_BETS_PER_STREET bets and raises go in per street.
+// The runout is dealt up front; board() holds only the cards shown so far.
+// Chips stay where they were bet until the end: a finished hand reports
+// winnings() instead of paying out, so undo() needs no record of the payout.
+class GameState {
+public:
+    static constexpr int MAX_BETS_PER_STREET = 4;
+    static constexpr int MAX_ACTIONS = 24; // 4 streets of check, bet, 3 raises, call
+    static constexpr int MAX_CHIPS = (1 << 28) - 1;
+
+    enum class Phase : uint8_t { Betting, Folded, Showdown };
+
+    GameState() = default; // Empty; start hands with newHand()
+
+    // Posts min(blind, stack) for each seat. A seat left without chips goes
+    // straight to showdown. Throws std::invalid_argument for overlapping cards
+    // or stacks and blinds outside 1..MAX_CHIPS.
+    static GameState newHand(const Hand& hole0, const Hand& hole1, const std::vector<Card>& board,
+                             int stack0, int stack1, int blind);
+
+    Phase phase() const { return static_cast<Phase>(phase_); }
+    bool isTerminal() const { return phase_ != static_cast<uint8_t>(Phase::Betting); }
+    int street() const { return street_; } // 0 preflop, 1 flop, 2 turn, 3 river
+    int boardCards() const { return street_ == 0 ? 0 : street_ + 2; }
+    CardSet board() const;                  // The boardCards() cards shown
+    Card boardCard(int i) const { return Card::fromIndex(board_[i]); } // Runout order, 0..4
+    CardSet hole(int seat) const;
+
+    int toAct() const; // Seat to act while Betting
+    int stack(int seat) const { return stacks_[seat]; }         // Chips behind
+    int committed(int seat) const { return committed_[seat]; }  // Put in the pot this hand
+    int streetBet(int seat) const;                               // Put in on this street
+    int pot() const { return committed_[0] + committed_[1]; }
+    int toCall() const; // For the seat to act
+    int blind() const { return blind_; }
+    int betsThisStreet() const; // Bets and raises so far
+
+    // Menu for search: fold, check or call, and bets or raises of one blind,
+    // half pot, pot and all-in (duplicates removed). Empty once terminal.
+    ActionList legalActions() const;
+    // Any bet of 1..stack chips, or raise above the call, is legal while under the cap
+    bool isLegal(const Action& action) const;
+
+    // Throws std::logic_error once terminal, std::invalid_argument if !isLegal(action)
+    void apply(const Action& action);
+    // Takes back the last apply(); throws std::logic_error if there is none
+    void undo();
+
+    int numActions() const { return numActions_; }
+    Action action(int i) const; // i-th action applied, 0 = first
+
+    // Chips from the pot for seat in a terminal state: everything to the
+    // player who did not fold, else the best hand takes the matched part
+    // (split on a tie) and unmatched chips go back
+    int winnings(int seat) const;
+    int net(int seat) const { return winnings(seat) - committed_[seat]; }
+
+private:
+    // history_ entries: bits 0-2 type, bit 3 closed the street, bits 4-31 amount
+    static constexpr uint32_t CLOSES_STREET = 1u << 3;
+    static uint32_t encode(const Action& action, bool closesStreet);
+    static Action decode(uint32_t entry);
+
+    int streetStart() const; // Index of the first action of the current street
+    void addAction(ActionList& list, Action::Type type, int amount) const;
+
+    int32_t stacks_[2] = {};
+    int32_t committed_[2] = {};
+    int32_t blind_ = 0;
+    uint8_t holes_[2][2] = {};
+    uint8_t board_[5] = {};
+    uint8_t street_ = 0;
+    uint8_t numActions_ = 0;
+    uint8_t phase_ = 0;
+    uint32_t history_[MAX_ACTIONS] = {};
+};
+
+static_assert(std::is_trivially_copyable<GameState>::value, "GameState is copied as a snapshot");
+static_assert(sizeof(GameState) <= 128, "GameState should fit two cache lines");
+
+#endif // GAMESTATE_H
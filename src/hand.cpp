@@ -3,16 +3,19 @@
 #include <vector>
 #include <algorithm>
 #include <iostream>
+#include <utility>
 
-Hand::Hand(std::vector<Card> cards) {
-    this->cards = cards;
+Hand::Hand(std::vector<Card> cards) : cardSet(cards) {
+    this->cards = std::move(cards);
 }
 void Hand::addCard(const Card& card) {
     cards.push_back(card);
+    cardSet.add(card);
 }
 
 void Hand::clear() {
     cards.clear();
+    cardSet = CardSet();
 }
 
 std::string Hand::toString() const {
@@ -28,6 +31,7 @@ std::string Hand::toString() const {
 Hand Hand::combineHands(const Hand& other) {
     Hand combined = *this;
     combined.cards.insert(combined.cards.end(), other.cards.begin(), other.cards.end());
+    combined.cardSet |= other.cardSet;
     return combined;
 }
 const std::vector<Card>& Hand::getCards() const {
@@ -5,6 +5,7 @@
 #include <string>
 
 #include "card.h"
+#include "cardSet.h"
 
 class Hand {
 public:
@@ -22,11 +23,15 @@ public:
     const std::vector<Card>& getCards() const;
     std::vector<Card> getCards(std::vector<Card> addition) const;
 
+    // Same cards as a bitmask, kept in sync by addCard/clear
+    CardSet getCardSet() const { return cardSet; }
+
     std::vector<Card> getSortedCards() const;
     void print() const;
 
 protected:
     std::vector<Card> cards;
+    CardSet cardSet;
 };
 
 #endif // HAND_H
\ No newline at end of file
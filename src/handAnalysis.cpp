@@ -0,0 +1,258 @@
+#include "handAnalysis.h"
+#include "cardSet.h"
+#include "evaluator.h"
+#include "handHistory.h"
+#include "profiler.h"
+#include "rng.h"
+#include "threadPool.h"
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr size_t RECORDS_PER_CHUNK = 16384; // Unit of work; ~2.3 MB of records
+
+// +1 if seat 0 wins, -1 if seat 1 does, 0 on a tie
+int showdown(CardSet hole0, CardSet hole1, CardSet board) {
+    const uint16_t strength0 = Evaluator::evaluate(hole0 | board);
+    const uint16_t strength1 = Evaluator::evaluate(hole1 | board);
+    return (strength0 > strength1) - (strength0 < strength1);
+}
+
+// Suits renamed in order of first appearance, with each hole sorted high card
+// first, so suit-isomorphic preflop matchups share one key and one equity
+uint32_t canonicalMatchup(const uint8_t hole0[2], const uint8_t hole1[2], uint8_t canonical[4]) {
+    uint8_t cards[4] = {hole0[0], hole0[1], hole1[0], hole1[1]};
+    for (int seat = 0; seat < 2; ++seat) {
+        uint8_t* hole = cards + 2 * seat;
+        if (hole[0] % 13 < hole[1] % 13 || (hole[0] % 13 == hole[1] % 13 && hole[0] > hole[1]))
+            std::swap(hole[0], hole[1]);
+    }
+    int rename[4] = {-1, -1, -1, -1};
+    int nextSuit = 0;
+    uint32_t key = 0;
+    for (int i = 0; i < 4; ++i) {
+        const int suit = cards[i] / 13;
+        if (rename[suit] < 0) rename[suit] = nextSuit++;
+        canonical[i] = static_cast<uint8_t>(rename[suit] * 13 + cards[i] % 13);
+        key |= static_cast<uint32_t>(canonical[i]) << (6 * i);
+    }
+    return key;
+}
+
+double preflopEquity(const uint8_t canonical[4], uint32_t key, uint32_t samples, uint64_t seed) {
+    const CardSet hole0(uint64_t(1) << canonical[0] | uint64_t(1) << canonical[1]);
+    const CardSet hole1(uint64_t(1) << canonical[2] | uint64_t(1) << canonical[3]);
+    int deck[48];
+    int size = 0;
+    (hole0 | hole1).complement().forEach([&](int index) { deck[size++] = index; });
+
+    Rng rng = Rng::forStream(seed, key);
+    int64_t score = 0; // Twice seat 0's share, summed
+    for (uint32_t sample = 0; sample < samples; ++sample) {
+        CardSet board;
+        for (int i = 0; i < 5; ++i) { // Partial Fisher-Yates over the 48 live cards
+            std::swap(deck[i], deck[i + rng.below(static_cast<uint32_t>(size - i))]);
+            board.add(deck[i]);
+        }
+        score += 1 + showdown(hole0, hole1, board);
+    }
+    return samples ? score / (2.0 * samples) : 0.5;
+}
+
+// Preflop equities shared by all threads of one run; shards keep the locks uncontended
+class PreflopCache {
+public:
+    double equity(const uint8_t hole0[2], const uint8_t hole1[2], uint32_t samples, uint64_t seed) {
+        uint8_t canonical[4];
+        const uint32_t key = canonicalMatchup(hole0, hole1, canonical);
+        Shard& shard = shards_[key % NUM_SHARDS];
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            const auto found = shard.equity.find(key);
+            if (found != shard.equity.end()) return found->second;
+        }
+        // Two threads may both compute a missing matchup; they get the same value
+        const double equity = preflopEquity(canonical, key, samples, seed);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.equity.emplace(key, equity);
+        return equity;
+    }
+
+private:
+    static constexpr size_t NUM_SHARDS = 64;
+    struct Shard {
+        std::mutex mutex;
+        std::unordered_map<uint32_t, double> equity;
+    };
+    Shard shards_[NUM_SHARDS];
+};
+
+void addHand(PlayerResult& result, int net, double evNet, double streetEvNet, int blind, bool allIn) {
+    ++result.hands;
+    result.allIns += allIn;
+    result.net += net;
+    result.evNet += evNet;
+    result.streetEvNet += streetEvNet;
+    if (blind > 0) {
+        result.netBlinds += static_cast<double>(net) / blind;
+        result.evBlinds += evNet / blind;
+        result.streetEvBlinds += streetEvNet / blind;
+    }
+}
+
+MatchupResult& matchup(std::vector<MatchupResult>& matchups, uint32_t configA, uint32_t configB) {
+    for (MatchupResult& found : matchups) {
+        if (found.configs[0] == configA && found.configs[1] == configB) return found;
+    }
+    matchups.emplace_back();
+    matchups.back().configs[0] = configA;
+    matchups.back().configs[1] = configB;
+    return matchups.back();
+}
+
+void analyzeHand(const HandRecord& record, const HandAnalysisOptions& options, PreflopCache& cache,
+                 HandAnalysisResult& totals) {
+    ++totals.hands;
+    double evNet[2] = {static_cast<double>(record.net[0]), static_cast<double>(record.net[1])};
+    double streetEvNet[2] = {evNet[0], evNet[1]};
+    bool allIn = false;
+    if (record.flags & HandRecord::TRUNCATED) {
+        ++totals.truncated; // Without every amount the matched chips are unknown
+    } else if (record.phase() == GameState::Phase::Showdown) {
+        ++totals.showdowns;
+        double equity[4] = {-1.0, -1.0, -1.0, -1.0}; // Seat 0's, after each street; computed when needed
+        auto equityAfter = [&](int street) {
+            if (equity[street] < 0.0) {
+                equity[street] = street == 0
+                    ? cache.equity(record.holes[0], record.holes[1], options.preflopSamples, options.seed)
+                    : HandAnalysis::allInEquity(record.holes[0], record.holes[1], record.board, street + 2,
+                                                options.preflopSamples, options.seed);
+            }
+            return equity[street];
+        };
+
+        // Unmatched chips go back whoever wins, so only the matched part is at stake
+        int committed[2] = {std::min(record.blind, record.startingStacks[0]),
+                            std::min(record.blind, record.startingStacks[1])};
+        int street = 0; // Where the last chips went in
+        int matchedBefore = 0; // At the end of the streets before this one
+        if (options.streetEv) streetEvNet[0] = 0.0;
+        for (int i = 0; i <= record.numActions; ++i) {
+            if (i == record.numActions || record.actionStreet(i) != street) {
+                const int matched = std::min(committed[0], committed[1]);
+                if (options.streetEv && matched > matchedBefore)
+                    streetEvNet[0] += (2.0 * equityAfter(street) - 1.0) * (matched - matchedBefore);
+                matchedBefore = matched;
+                if (i == record.numActions) break;
+                street = record.actionStreet(i);
+            }
+            committed[record.actionSeat(i)] += record.action(i).amount;
+        }
+        streetEvNet[1] = -streetEvNet[0];
+
+        if (street < 3 && (committed[0] >= record.startingStacks[0] || committed[1] >= record.startingStacks[1])) {
+            evNet[0] = (2.0 * equityAfter(street) - 1.0) * matchedBefore;
+            evNet[1] = -evNet[0];
+            allIn = true;
+            ++totals.allIns;
+        }
+    }
+
+    const int swapped = (record.flags & HandRecord::SWAPPED) ? 1 : 0;
+    MatchupResult& players = matchup(totals.matchups, record.configs[swapped], record.configs[swapped ^ 1]);
+    for (int seat = 0; seat < 2; ++seat) {
+        addHand(totals.seats[seat], record.net[seat], evNet[seat], streetEvNet[seat], record.blind, allIn);
+        addHand(players.players[seat ^ swapped], record.net[seat], evNet[seat], streetEvNet[seat], record.blind, allIn);
+    }
+}
+
+void merge(HandAnalysisResult& totals, const HandAnalysisResult& chunk) {
+    totals.hands += chunk.hands;
+    totals.showdowns += chunk.showdowns;
+    totals.allIns += chunk.allIns;
+    totals.truncated += chunk.truncated;
+    for (int i = 0; i < 2; ++i) totals.seats[i].add(chunk.seats[i]);
+    for (const MatchupResult& players : chunk.matchups) {
+        MatchupResult& into = matchup(totals.matchups, players.configs[0], players.configs[1]);
+        for (int i = 0; i < 2; ++i) into.players[i].add(players.players[i]);
+    }
+}
+
+} // namespace
+
+void PlayerResult::add(const PlayerResult& other) {
+    hands += other.hands;
+    allIns += other.allIns;
+    net += other.net;
+    evNet += other.evNet;
+    streetEvNet += other.streetEvNet;
+    netBlinds += other.netBlinds;
+    evBlinds += other.evBlinds;
+    streetEvBlinds += other.streetEvBlinds;
+}
+
+double HandAnalysis::allInEquity(const uint8_t hole0[2], const uint8_t hole1[2], const uint8_t board[5],
+                                 int boardCards, uint32_t preflopSamples, uint64_t seed) {
+    if (boardCards == 0) {
+        uint8_t canonical[4];
+        const uint32_t key = canonicalMatchup(hole0, hole1, canonical);
+        return preflopEquity(canonical, key, preflopSamples, seed);
+    }
+
+    const CardSet holes[2] = {CardSet(uint64_t(1) << hole0[0] | uint64_t(1) << hole0[1]),
+                              CardSet(uint64_t(1) << hole1[0] | uint64_t(1) << hole1[1])};
+    CardSet known;
+    for (int i = 0; i < boardCards; ++i) known.add(board[i]);
+    if (boardCards >= 5) return (1 + showdown(holes[0], holes[1], known)) / 2.0;
+
+    // At most two cards to come: 990 runouts from the flop, 44 from the turn
+    int live[48];
+    int size = 0;
+    (holes[0] | holes[1] | known).complement().forEach([&](int index) { live[size++] = index; });
+    int64_t score = 0;
+    int64_t runouts = 0;
+    for (int a = 0; a < size; ++a) {
+        CardSet turn = known;
+        turn.add(live[a]);
+        if (boardCards == 4) {
+            score += 1 + showdown(holes[0], holes[1], turn);
+            ++runouts;
+            continue;
+        }
+        for (int b = a + 1; b < size; ++b) {
+            CardSet river = turn;
+            river.add(live[b]);
+            score += 1 + showdown(holes[0], holes[1], river);
+            ++runouts;
+        }
+    }
+    return score / (2.0 * runouts);
+}
+
+HandAnalysisResult HandAnalysis::run(const HandHistoryReader& history, const HandAnalysisOptions& options) {
+    Evaluator::init();
+    const auto start = std::chrono::steady_clock::now();
+
+    const size_t numChunks = (history.size() + RECORDS_PER_CHUNK - 1) / RECORDS_PER_CHUNK;
+    std::vector<HandAnalysisResult> chunks(numChunks);
+    PreflopCache cache;
+
+    ThreadPool pool(ThreadPool::forCores(options.threads));
+    pool.parallelFor(numChunks, [&](size_t chunk) {
+        PROFILE_SCOPE("analysis/chunk");
+        HandAnalysisResult& totals = chunks[chunk];
+        const size_t end = std::min(history.size(), (chunk + 1) * RECORDS_PER_CHUNK);
+        for (size_t i = chunk * RECORDS_PER_CHUNK; i < end; ++i) analyzeHand(history[i], options, cache, totals);
+    });
+
+    // In chunk order, so the floating-point sums do not depend on scheduling
+    HandAnalysisResult result;
+    for (const HandAnalysisResult& chunk : chunks) merge(result, chunk);
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
@@ -0,0 +1,76 @@
+#ifndef HANDANALYSIS_H
+#define HANDANALYSIS_H
+
+#include <cstdint>
+#include <vector>
+
+class HandHistoryReader;
+
+// Luck-adjusted results of a hand-history log. A hand that reached showdown
+// with a player all-in before the river is credited at its all-in EV: the
+// matched chips times the equity when the last chips went in, rather than
+// whatever the runout dealt. Every other hand counts at its actual result.
+// With streetEv set, street EV prices every decision instead: the chips
+// matched on each street of a showdown hand count at the equity after that
+// street's last action, so the river's chips count at the actual result and
+// a folded hand at its net. That needs equities for nearly every showdown
+// rather than only the all-ins, so a run takes over 100 times as long.
+struct HandAnalysisOptions {
+    unsigned threads = 0;           // 0 = hardware_concurrency
+    uint32_t preflopSamples = 20000; // Monte Carlo runouts for a preflop all-in; later streets are enumerated
+    uint64_t seed = 1;              // Same seed gives the same result on any thread count
+    bool streetEv = false;          // Also compute PlayerResult::streetEvNet
+};
+
+struct PlayerResult {
+    uint64_t hands = 0;
+    uint64_t allIns = 0;     // Hands settled by all-in EV
+    int64_t net = 0;         // Chips actually won
+    double evNet = 0.0;      // Chips won with all-ins paid at their EV
+    double streetEvNet = 0.0; // With streetEv, chips won with each street's matched chips at its equity; else net
+    double netBlinds = 0.0;  // net in blinds of each hand, for bb/100
+    double evBlinds = 0.0;
+    double streetEvBlinds = 0.0;
+
+    double bbPer100() const { return hands ? 100.0 * netBlinds / hands : 0.0; }
+    double evBbPer100() const { return hands ? 100.0 * evBlinds / hands : 0.0; }
+    double streetEvBbPer100() const { return hands ? 100.0 * streetEvBlinds / hands : 0.0; }
+    double luck() const { return static_cast<double>(net) - evNet; } // Chips won above EV
+
+    void add(const PlayerResult& other);
+};
+
+// Hands between one pair of configurations. Player A is seat 0 unless the
+// record is HandRecord::SWAPPED, so A and B are self-play's players[0] and [1].
+struct MatchupResult {
+    uint32_t configs[2] = {0, 0}; // AIConfig::id() of A and B; HandRecord::HUMAN for a person
+    PlayerResult players[2];
+};
+
+struct HandAnalysisResult {
+    uint64_t hands = 0;
+    uint64_t showdowns = 0;
+    uint64_t allIns = 0;       // All-in before the river and called
+    uint64_t truncated = 0;    // Actions missing, so counted at the actual result
+    PlayerResult seats[2];
+    std::vector<MatchupResult> matchups; // In order of first appearance in the log
+    double seconds = 0.0;
+
+    double handsPerSecond() const { return seconds > 0.0 ? hands / seconds : 0.0; }
+};
+
+class HandAnalysis {
+public:
+    // Splits the log into chunks that the pool's threads claim as they go;
+    // each chunk sums into its own totals, merged in order at the end.
+    static HandAnalysisResult run(const HandHistoryReader& history, const HandAnalysisOptions& options);
+
+    // Seat 0's share of the pot (ties count half) with both holes and
+    // boardCards of board known. Enumerates the runouts from the flop on;
+    // preflop it samples preflopSamples runouts from a stream that depends
+    // only on seed and the matchup.
+    static double allInEquity(const uint8_t hole0[2], const uint8_t hole1[2], const uint8_t board[5],
+                              int boardCards, uint32_t preflopSamples, uint64_t seed);
+};
+
+#endif // HANDANALYSIS_H
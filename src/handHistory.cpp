@@ -0,0 +1,134 @@
+#include "handHistory.h"
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+
+namespace {
+
+constexpr uint32_t LOG_MAGIC = 0x4C484850; // "PHHL"
+constexpr uint16_t LOG_VERSION = 2; // 2: configs per seat
+
+struct LogHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t recordSize;
+    uint64_t reserved;
+};
+static_assert(sizeof(LogHeader) == 16, "Records start 8-byte aligned after the header");
+
+bool validHeader(const LogHeader& header) {
+    return header.magic == LOG_MAGIC && header.version == LOG_VERSION && header.recordSize == sizeof(HandRecord);
+}
+
+} // namespace
+
+void HandRecord::addAction(int seat, int street, const Action& action) {
+    if (seat < 0 || seat > 1 || street < 0 || street > 3 || action.amount < 0 || action.amount > MAX_AMOUNT)
+        throw std::invalid_argument("Action out of range for a hand record");
+    if (numActions == MAX_ACTIONS) {
+        flags |= TRUNCATED;
+        return;
+    }
+    actions[numActions++] = static_cast<uint32_t>(action.type) | static_cast<uint32_t>(seat) << 3 |
+                            static_cast<uint32_t>(street) << 4 | static_cast<uint32_t>(action.amount) << 6;
+}
+
+Action HandRecord::action(int i) const {
+    return Action{static_cast<Action::Type>(actions[i] & 7u), static_cast<int>(actions[i] >> 6)};
+}
+
+HandRecord HandRecord::fromState(const GameState& state, uint64_t seed, uint64_t handNumber) {
+    HandRecord record;
+    record.seed = seed;
+    record.handNumber = handNumber;
+    record.blind = state.blind();
+    record.outcome = static_cast<uint8_t>(state.phase());
+    for (int seat = 0; seat < 2; ++seat) {
+        record.startingStacks[seat] = state.stack(seat) + state.committed(seat); // Nothing is paid out in a GameState
+        record.net[seat] = state.isTerminal() ? state.net(seat) : 0;
+        int card = 0;
+        state.hole(seat).forEach([&](int index) { record.holes[seat][card++] = static_cast<uint8_t>(index); });
+    }
+    for (int i = 0; i < 5; ++i) record.board[i] = static_cast<uint8_t>(state.boardCard(i).getIndex());
+
+    // Seat and street of each action, found by taking the actions back
+    int seats[GameState::MAX_ACTIONS], streets[GameState::MAX_ACTIONS];
+    GameState rewound = state;
+    for (int i = state.numActions() - 1; i >= 0; --i) {
+        rewound.undo();
+        seats[i] = rewound.toAct();
+        streets[i] = rewound.street();
+    }
+    for (int i = 0; i < state.numActions(); ++i) record.addAction(seats[i], streets[i], state.action(i));
+    return record;
+}
+
+HandHistoryWriter::HandHistoryWriter(const std::string& path) {
+    std::error_code error;
+    const uintmax_t size = std::filesystem::exists(path, error) ? std::filesystem::file_size(path, error) : 0;
+    if (error) throw std::runtime_error("Cannot open hand history " + path);
+
+    if (size > 0) {
+        LogHeader header{};
+        std::FILE* in = std::fopen(path.c_str(), "rb");
+        const bool read = in && std::fread(&header, sizeof(header), 1, in) == 1;
+        if (in) std::fclose(in);
+        if (!read || !validHeader(header))
+            throw std::runtime_error(path + " is not a version " + std::to_string(LOG_VERSION) + " hand history");
+
+        // A record cut short by a crash would misalign everything appended after it
+        const uintmax_t whole = sizeof(LogHeader) + (size - sizeof(LogHeader)) / sizeof(HandRecord) * sizeof(HandRecord);
+        if (whole != size) std::filesystem::resize_file(path, whole, error);
+        if (error) throw std::runtime_error("Cannot repair hand history " + path);
+    }
+
+    file_ = std::fopen(path.c_str(), "ab");
+    if (!file_) throw std::runtime_error("Cannot open hand history " + path);
+    if (size == 0) {
+        const LogHeader header{LOG_MAGIC, LOG_VERSION, static_cast<uint16_t>(sizeof(HandRecord)), 0};
+        if (std::fwrite(&header, sizeof(header), 1, file_) != 1) {
+            std::fclose(file_);
+            throw std::runtime_error("Cannot write hand history " + path);
+        }
+    }
+}
+
+HandHistoryWriter::~HandHistoryWriter() {
+    if (file_) std::fclose(file_);
+}
+
+void HandHistoryWriter::append(const HandRecord& record) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (std::fwrite(&record, sizeof(record), 1, file_) != 1) throw std::runtime_error("Cannot write hand history");
+    ++written_;
+}
+
+void HandHistoryWriter::flush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::fflush(file_);
+}
+
+uint64_t HandHistoryWriter::recordsWritten() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return written_;
+}
+
+std::string HandHistoryWriter::defaultPath() {
+    const char* env = std::getenv("POKER_HAND_HISTORY");
+    if (env && *env) return env;
+    return "hand_history.phh";
+}
+
+HandHistoryReader::HandHistoryReader(const std::string& path) {
+    if (!file_.open(path) || file_.size() < sizeof(LogHeader))
+        throw std::runtime_error("Cannot map hand history " + path);
+    LogHeader header;
+    std::memcpy(&header, file_.data(), sizeof(header));
+    if (!validHeader(header))
+        throw std::runtime_error(path + " is not a version " + std::to_string(LOG_VERSION) + " hand history");
+
+    // The mapping is page aligned and the header keeps the records 8-byte aligned
+    records_ = reinterpret_cast<const HandRecord*>(file_.data() + sizeof(LogHeader));
+    count_ = (file_.size() - sizeof(LogHeader)) / sizeof(HandRecord); // A torn last record is ignored
+}
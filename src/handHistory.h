@@ -0,0 +1,97 @@
+#ifndef HANDHISTORY_H
+#define HANDHISTORY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include "gameState.h"
+#include "mappedFile.h"
+
+// One finished heads-up hand as a fixed-size, trivially copyable record, the
+// unit of the hand-history log. Cards are CardSet indices; actions pack the
+// type (bits 0-2), seat (bit 3), street (bits 4-5) and chips added (bits 6-31).
+struct HandRecord {
+    static constexpr int MAX_ACTIONS = GameState::MAX_ACTIONS;
+    static constexpr int MAX_AMOUNT = (1 << 26) - 1;
+    static constexpr uint8_t TRUNCATED = 1; // flags: more than MAX_ACTIONS actions; the rest were dropped
+    static constexpr uint8_t SWAPPED = 2;   // flags: seat 0 holds the second player (self-play's players[1])
+    static constexpr uint32_t HUMAN = 0;    // configs: a person, not an AIConfig
+
+    uint64_t seed = 0;          // Seed the deal came from; with handNumber it identifies the deal
+    uint64_t handNumber = 0;    // Per log writer session, or per self-play run
+    int32_t startingStacks[2] = {0, 0}; // Before the blinds
+    int32_t blind = 0;
+    int32_t net[2] = {0, 0};    // Chips won (or lost, negative) per seat
+    uint8_t holes[2][2] = {{0, 0}, {0, 0}};
+    uint8_t board[5] = {0, 0, 0, 0, 0}; // The whole runout, shown or not
+    uint8_t numActions = 0;
+    uint8_t outcome = 0;        // GameState::Phase: Folded or Showdown
+    uint8_t flags = 0;
+    uint32_t actions[MAX_ACTIONS] = {};
+    uint32_t configs[2] = {HUMAN, HUMAN}; // AIConfig::id() of the player in each seat
+
+    // Appends one action; past MAX_ACTIONS it only sets TRUNCATED. Throws
+    // std::invalid_argument for a seat, street or amount out of range.
+    void addAction(int seat, int street, const Action& action);
+
+    Action action(int i) const;
+    int actionSeat(int i) const { return (actions[i] >> 3) & 1; }
+    int actionStreet(int i) const { return (actions[i] >> 4) & 3; }
+    GameState::Phase phase() const { return static_cast<GameState::Phase>(outcome); }
+
+    // Cards, blind, starting stacks, actions and result of a finished GameState
+    static HandRecord fromState(const GameState& state, uint64_t seed, uint64_t handNumber);
+};
+static_assert(std::is_trivially_copyable<HandRecord>::value, "HandRecord is written and mapped as raw bytes");
+static_assert(sizeof(HandRecord) == 152, "HandRecord layout is part of the file format");
+
+// Appends HandRecords to a log file: a 16-byte versioned header, then the
+// records back to back in host byte order. Reopening continues the log; a
+// record cut short by a crash is dropped. append() is thread-safe.
+class HandHistoryWriter {
+public:
+    // Throws std::runtime_error if the file cannot be opened or holds another format
+    explicit HandHistoryWriter(const std::string& path);
+    ~HandHistoryWriter();
+
+    HandHistoryWriter(const HandHistoryWriter&) = delete;
+    HandHistoryWriter& operator=(const HandHistoryWriter&) = delete;
+
+    void append(const HandRecord& record);
+    void flush();
+    uint64_t recordsWritten() const; // This session
+
+    // $POKER_HAND_HISTORY if set, else hand_history.phh in the working directory
+    static std::string defaultPath();
+
+private:
+    std::FILE* file_ = nullptr;
+    mutable std::mutex mutex_;
+    uint64_t written_ = 0;
+};
+
+// Memory-mapped view of a hand-history log. The records are read in place,
+// without copying, so iterating a large history costs only the page faults.
+class HandHistoryReader {
+public:
+    HandHistoryReader() = default;
+
+    // Throws std::runtime_error for a missing file or one with another format or version
+    explicit HandHistoryReader(const std::string& path);
+
+    size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+    const HandRecord& operator[](size_t i) const { return records_[i]; }
+    const HandRecord* begin() const { return records_; }
+    const HandRecord* end() const { return records_ + count_; }
+
+private:
+    MappedFile file_;
+    const HandRecord* records_ = nullptr;
+    size_t count_ = 0;
+};
+
+#endif // HANDHISTORY_H
@@ -6,14 +6,23 @@
 #include <algorithm>
 #include <string>
 #include <cctype>
+#include <chrono>
 #include <cstdlib> // For rand, srand
 #include <ctime>   // For time
+#include <memory>
 #include "hand.h"
 #include "card.h"
 #include "comparer.h"
 #include "deck.h"
+#include "aiPolicy.h"
+#include "evaluator.h"
+#include "handHistory.h"
+#include "metrics.h"
 #include "playerAI.h"
+#include "profiler.h"
 #include "ui.h" // NEW
+#include "assetLoader.h"
+#include "threadPool.h"
 
 // -----------------------------------------------------------------------------
 // Constants and globals
@@ -32,15 +41,38 @@ constexpr float P1_HAND_Y      = 800.f;
 constexpr float P2_HAND_Y      = 200.f;
 constexpr float COMMUNITY_Y    = 500.f;
 
-// AI thresholds (tuned elsewhere at runtime)
-float AI_FOLD_THRESHOLD = 0.35f;
-float AI_RAISE_THRESHOLD = 0.55f;
-float AI_CALL_THRESHOLD = 0.55f;
-float AI_AGGRESSIVENESS = 0.1f;
+// AI betting policy; aggressiveness is randomised per run in main()
+AIConfig aiConfig;
+Rng aiRng(Rng::randomSeed()); // Noise in the AI's fold threshold
+
+// Exported when POKER_METRICS is set (see MetricsExporter::fromEnvironment)
+Counter& handsPlayed = Metrics::counter("poker_hands_played_total", "Hands played to the end");
+Histogram& aiDecisionLatency = Metrics::latency("poker_ai_decision_seconds",
+                                                "Time from the player's action to the AI's answer");
+Histogram& frameTime = Metrics::latency("poker_frame_seconds", "Work per rendered frame, display() excluded");
+
+// Finished hands are appended to HandHistoryWriter::defaultPath(); null if it could not be opened
+std::unique_ptr<HandHistoryWriter> handHistory;
+HandRecord currentHand; // Seat 0 is the player, seat 1 the AI
+uint64_t handNumber = 0;
 
 // -----------------------------------------------------------------------------
 // Helpers
 // -----------------------------------------------------------------------------
+// Streets follow the visible board: preflop, flop, turn, river
+static void recordAction(int seat, size_t cardsToShow, const Action& action) {
+    currentHand.addAction(seat, cardsToShow == 0 ? 0 : static_cast<int>(cardsToShow) - 2, action);
+    if (action.type == Action::Type::Fold) currentHand.outcome = static_cast<uint8_t>(GameState::Phase::Folded);
+}
+
+static void logFinishedHand(int player1score, int player2score) {
+    if (!handHistory) return;
+    currentHand.net[0] = player1score - currentHand.startingStacks[0];
+    currentHand.net[1] = player2score - currentHand.startingStacks[1];
+    handHistory->append(currentHand);
+    handHistory->flush(); // A hand every few seconds; keep the log whole if the game is killed
+}
+
 static std::vector<Card> makeVisibleBoard(const std::vector<Card>& communityCards, size_t cardsToShow) {
     std::vector<Card> visible;
     if (cardsToShow > 0 && cardsToShow <= communityCards.size()) {
@@ -63,33 +95,20 @@ static void enterAllInIfNeeded(bool gameFinished,
     }
 }
 
-// Stretches fold threshold based on bet/stack ratio and small randomness (same logic, centralized)
-static float computeCurrentFoldThreshold(int amountForAIToCall, size_t cardsToShow, int player2score) {
-    float current = AI_FOLD_THRESHOLD;
-
-    if (cardsToShow > 0 && amountForAIToCall > 0 && player2score > 0) {
-        float bet_to_stack_ratio = static_cast<float>(amountForAIToCall) / player2score;
-
-        float calculated_increase = 0.0f;
-        if (bet_to_stack_ratio > 0.5f) {
-            calculated_increase = 0.2f;
-        } else if (bet_to_stack_ratio > 0.25f) {
-            calculated_increase = 0.1f;
-        }
-
-        float actual_increase = calculated_increase;
-        if (calculated_increase > 0.0f) {
-            float bluff_call_tendency_chance = 0.3f; // 30% chance to be less cautious
-            if ((static_cast<float>(rand()) / RAND_MAX) < bluff_call_tendency_chance) {
-                actual_increase *= ((static_cast<float>(rand()) / RAND_MAX) * 0.7f);
-            }
-        }
-
-        current = std::min(current + actual_increase, 0.9f);
+// AI response waiting on a background equity evaluation. While one is pending
+// the player's buttons are hidden and the table shows the AI as thinking.
+struct PendingAIDecision {
+    enum class Kind { None, RespondToBet, RespondToCheck };
+    Kind kind = Kind::None;
+    EquityTask task;
+    uint64_t startedNs = 0; // Profiler::nowNs() at submission, for the decision latency
+
+    bool active() const { return kind != Kind::None; }
+    void cancel() {
+        task.cancel();
+        *this = PendingAIDecision();
     }
-
-    return current;
-}
+};
 
 // -----------------------------------------------------------------------------
 // Forward declarations (game flow)
@@ -108,26 +127,39 @@ void determineAndSetWinner(Hand& player1Hand, Hand& player2Hand, const std::vect
                            std::string& winnerText, int& winner, bool& player1Out, bool& player2Out,
                            const std::string& player1Name, const std::string& player2Name);
 
-void handlePlayerBetAction(playerAI& ai,
-                           int& pendingStake, int& player1score, int& player2score,
-                           int& player1BetDisplay, int& player2BetDisplay, int& pot,
-                           bool& allInPhase, size_t& cardsToShow, bool& riverBettingPhase, bool& finalStakePhase,
+void handlePlayerBetAction(playerAI& ai, PendingAIDecision& pendingAI,
+                           int& pendingStake, int& player1score,
+                           int& player1BetDisplay, int player2BetDisplay, int& pot,
+                           bool& allInPhase, size_t cardsToShow,
                            const Hand& player2Hand, const std::vector<Card>& communityCards,
-                           std::string& winnerText, bool& gameFinished, int& winner,
-                           const std::string& player1Name, const std::string& player2Name);
+                           std::string& winnerText, bool gameFinished);
 
-void handlePlayerWaitAction(playerAI& ai, 
+void finishAIBetResponse(double winChance,
+                         int& player1score, int& player2score,
+                         int& player1BetDisplay, int& player2BetDisplay, int& pot,
+                         bool& allInPhase, size_t& cardsToShow, bool& riverBettingPhase, bool& finalStakePhase,
+                         std::string& winnerText, bool& gameFinished, int& winner,
+                         const std::string& player1Name, const std::string& player2Name);
+
+void handlePlayerWaitAction(playerAI& ai, PendingAIDecision& pendingAI,
                             size_t& cardsToShow, bool& riverBettingPhase, bool& finalStakePhase,
                             int& player1score, int& player2score,
                             int& player1BetDisplay, int& player2BetDisplay, int& pot,
                             bool& allInPhase,
                             const Hand& player2Hand, const std::vector<Card>& communityCards, 
-                            std::string& winnerText, bool& gameFinished, int& winner,
-                            const std::string& player1Name, const std::string& player2Name);
+                            std::string& winnerText, bool& gameFinished);
+
+void finishAICheckResponse(double winChance,
+                           size_t& cardsToShow, bool& riverBettingPhase, bool& finalStakePhase,
+                           int& player1score, int& player2score,
+                           int& player1BetDisplay, int& player2BetDisplay, int& pot,
+                           bool& allInPhase, std::string& winnerText, bool& gameFinished,
+                           const std::string& player2Name);
 
 void handlePlayerPassAction(bool& gameFinished, int& winner, std::string& winnerText, int& pot, int& player2score, int& player1score, const std::string& player2Name);
 
-void updateAIInfo(playerAI& ai, const Hand& player2Hand, const std::vector<Card>& communityCards, size_t cardsToShow,
+void updateAIInfo(playerAI& ai, EquityTask& infoTask, EquitySamples& infoSamples,
+                  const Hand& player2Hand, const std::vector<Card>& communityCards, size_t cardsToShow,
                   double& lastP2WinPercentage, int& lastCardsToShowState);
 
 // -----------------------------------------------------------------------------
@@ -136,11 +168,24 @@ void updateAIInfo(playerAI& ai, const Hand& player2Hand, const std::vector<Card>
 int main() {
     srand(static_cast<unsigned int>(time(nullptr))); // Seed for rand()
 
+    // Card images and font decode on the pool while the tables load and the window opens;
+    // 0.18 is the on-table card scale
+    ui::AssetLoader assets;
+    assets.start("src/PNG-cards", 0.18f,
+                 {"arial.ttf", "C:/Windows/Fonts/arial.ttf",
+                  "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
+                  "/System/Library/Fonts/Supplemental/Arial.ttf"},
+                 ThreadPool::shared());
+    Evaluator::init(); // Build or map the hand tables before the first AI decision
+    const auto metricsExporter = MetricsExporter::fromEnvironment();
+    try {
+        handHistory = std::make_unique<HandHistoryWriter>(HandHistoryWriter::defaultPath());
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "; hands will not be logged" << std::endl;
+    }
+
     // Slight variability per run
-    AI_AGGRESSIVENESS = ((static_cast<float>(rand()) / RAND_MAX) * 0.2f) - 0.1f;
-    AI_CALL_THRESHOLD  += AI_AGGRESSIVENESS;
-    AI_RAISE_THRESHOLD += AI_AGGRESSIVENESS;
-    AI_FOLD_THRESHOLD  += AI_AGGRESSIVENESS;
+    aiConfig.aggressiveness = ((static_cast<float>(rand()) / RAND_MAX) * 0.2f) - 0.1f;
 
     std::string player1Name = "Player";
     std::vector<std::string> aiNames = {"Ben", "Ken", "Friederick", "Viper", "Jester", "Jonathan", "michał"};
@@ -159,9 +204,16 @@ int main() {
     int winner = -1;
     bool player1Out = false, player2Out = false, overallGameFinished = false;
 
+    EquitySamples infoSamples; // Win-percentage samples reused across streets; outlives ai's tasks
     playerAI ai;
+    EquityOptions aiOptions; // ~0.3% standard error is plenty for threshold decisions
+    aiOptions.targetStdError = 0.003;
+    aiOptions.timeBudget = std::chrono::milliseconds(250);
+    ai.setDefaultOptions(aiOptions);
     double lastP2WinPercentage = 0.0;
     int lastCardsToShowState = -1;
+    EquityTask infoTask;          // Background win-percentage refresh
+    PendingAIDecision pendingAI;  // AI action waiting on its equity
 
     startNewRound(deck, player1Hand, player2Hand, communityCards, cardsToShow,
                   player1score, player2score, player1BetDisplay, player2BetDisplay, pot,
@@ -169,15 +221,37 @@ int main() {
 
     sf::RenderWindow window(sf::VideoMode(LOGICAL_WIDTH, LOGICAL_HEIGHT), "Poker Table");
     window.setFramerateLimit(60);
-    sf::Font font;
-    if (!font.loadFromFile("arial.ttf")) {
-        if (!font.loadFromFile("C:/Windows/Fonts/arial.ttf") &&
-            !font.loadFromFile("/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf") &&
-            !font.loadFromFile("/System/Library/Fonts/Supplemental/Arial.ttf")) {
-            std::cerr << "Could not load font!" << std::endl;
-            return 1;
+    // Progress bar until the background loader is done; nothing below draws before the assets exist
+    while (window.isOpen() && !assets.ready()) {
+        sf::Event event;
+        while (window.pollEvent(event)) {
+            if (event.type == sf::Event::Closed) window.close();
         }
+        const sf::Vector2f barSize(600.f, 24.f);
+        const sf::Vector2f barPos((LOGICAL_WIDTH - barSize.x) / 2.f, (LOGICAL_HEIGHT - barSize.y) / 2.f);
+        sf::RectangleShape frame(barSize);
+        frame.setPosition(barPos);
+        frame.setFillColor(sf::Color::Transparent);
+        frame.setOutlineColor(sf::Color::White);
+        frame.setOutlineThickness(2.f);
+        sf::RectangleShape fill(sf::Vector2f(barSize.x * assets.progress(), barSize.y));
+        fill.setPosition(barPos);
+        fill.setFillColor(sf::Color::White);
+        window.clear(sf::Color(0, 75, 0));
+        window.draw(frame);
+        window.draw(fill);
+        window.display();
     }
+    if (!window.isOpen()) return 0;
+
+    sf::Font font;
+    ui::CardAtlas cardAtlas;
+    if (!assets.finish(cardAtlas, font)) {
+        std::cerr << "Could not load font!" << std::endl;
+        return 1;
+    }
+    if (!cardAtlas.isLoaded())
+        std::cerr << "Could not load card images, drawing blank cards" << std::endl;
 
     sf::View mainView(sf::FloatRect(0.f, 0.f, static_cast<float>(LOGICAL_WIDTH), static_cast<float>(LOGICAL_HEIGHT)));
     auto updateView = [&](sf::Vector2u newWindowSize) {
@@ -209,14 +283,42 @@ int main() {
     ui::Button quitButton      = ui::createButton("Quit Game",  font, {200, 60}, {LOGICAL_WIDTH / 2.0f +  20, BUTTON_Y}, sf::Color(255, 100, 100), sf::Color::Black);
 
     std::vector<ui::Button*> activeButtons;
+    ui::TableView table(font, cardAtlas, player1Name, player2Name, LOGICAL_WIDTH, LOGICAL_HEIGHT);
+    bool redraw = true;
+    bool roundCounted = false;
+
+    // F3 shows the overlay and starts recording; F4 saves the recording as a Chrome trace
+    ui::ProfilerOverlay overlay(font);
+    double lastFrameMs = 0.0, lastAIDecisionMs = 0.0, lastSimulationsPerSecond = 0.0;
 
     while (window.isOpen()) {
+        // Idle table: sleep until the next event. While the AI or the win
+        // percentage is being computed, poll so the result is picked up promptly.
+        const bool busy = pendingAI.active() || infoTask.valid();
         sf::Event event;
-        while (window.pollEvent(event)) {
+        bool haveEvent = busy || redraw ? window.pollEvent(event) : window.waitEvent(event);
+        const uint64_t frameStart = Profiler::nowNs(); // Idle waiting is not frame time
+        for (; haveEvent; haveEvent = window.pollEvent(event)) {
+            PROFILE_SCOPE("main/event");
             if (event.type == sf::Event::Closed)
                 window.close();
-            if (event.type == sf::Event::Resized)
+            if (event.type == sf::Event::Resized) {
                 updateView(sf::Vector2u(event.size.width, event.size.height));
+                redraw = true;
+            }
+            if (event.type == sf::Event::GainedFocus)
+                redraw = true; // Some platforms drop the back buffer while hidden
+            if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F3) {
+                overlay.setVisible(!overlay.isVisible());
+                Profiler::setEnabled(overlay.isVisible());
+                redraw = true;
+            }
+            if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F4) {
+                if (Profiler::writeChromeTrace("poker_trace.json"))
+                    std::cout << "Trace written to poker_trace.json" << std::endl;
+                else
+                    std::cerr << "Could not write poker_trace.json" << std::endl;
+            }
             if (event.type == sf::Event::MouseButtonPressed) {
                 sf::Vector2i pixelPos = sf::Mouse::getPosition(window);
                 sf::Vector2f worldPos = window.mapPixelToCoords(pixelPos, mainView);
@@ -228,11 +330,12 @@ int main() {
                         startNewRound(deck, player1Hand, player2Hand, communityCards, cardsToShow,
                                       player1score, player2score, player1BetDisplay, player2BetDisplay, pot,
                                       finalStakePhase, gameFinished, riverBettingPhase, winnerText, winner, allInPhase);
+                        pendingAI.cancel();
                         lastCardsToShowState = -1;
                     } else if (ui::isButtonClicked(quitButton, sf::Vector2i(worldPos.x, worldPos.y))) {
                         window.close();
                     }
-                } else if (!gameFinished && !player1Out && !player2Out) {
+                } else if (!gameFinished && !player1Out && !player2Out && !pendingAI.active()) {
                     if (ui::isButtonClicked(add10Button, sf::Vector2i(worldPos.x, worldPos.y)))
                         pendingStake = std::min(pendingStake + 10, player1score);
                     else if (ui::isButtonClicked(add50Button, sf::Vector2i(worldPos.x, worldPos.y)))
@@ -240,28 +343,28 @@ int main() {
                     else if (ui::isButtonClicked(add100Button, sf::Vector2i(worldPos.x, worldPos.y)))
                         pendingStake = std::min(pendingStake + 100, player1score);
                     else if (ui::isButtonClicked(waitButton, sf::Vector2i(worldPos.x, worldPos.y)))
-                        handlePlayerWaitAction(ai, cardsToShow, riverBettingPhase, finalStakePhase,
+                        handlePlayerWaitAction(ai, pendingAI, cardsToShow, riverBettingPhase, finalStakePhase,
                                                player1score, player2score, player1BetDisplay, player2BetDisplay, pot,
                                                allInPhase, player2Hand, communityCards,
-                                               winnerText, gameFinished, winner, player1Name, player2Name);
+                                               winnerText, gameFinished);
                     else if (ui::isButtonClicked(resetButton, sf::Vector2i(worldPos.x, worldPos.y)))
                         pendingStake = 0;
                     else if (ui::isButtonClicked(passButton, sf::Vector2i(worldPos.x, worldPos.y))) {
+                        recordAction(0, cardsToShow, Action{Action::Type::Fold, 0});
                         handlePlayerPassAction(gameFinished, winner, winnerText, pot, player2score, player1score, player2Name);
                         if (player1score <= 0) player1Out = true; 
                         if (player2score <= 0) player2Out = true;
                     } else if (ui::isButtonClicked(submitButton, sf::Vector2i(worldPos.x, worldPos.y))) {
                         if (pendingStake > 0)
-                            handlePlayerBetAction(ai, pendingStake, player1score, player2score,
-                                                  player1BetDisplay, player2BetDisplay, pot,
-                                                  allInPhase, cardsToShow, riverBettingPhase, finalStakePhase,
-                                                  player2Hand, communityCards,
-                                                  winnerText, gameFinished, winner, player1Name, player2Name);
+                            handlePlayerBetAction(ai, pendingAI, pendingStake, player1score,
+                                                  player1BetDisplay, player2BetDisplay, pot, allInPhase, cardsToShow,
+                                                  player2Hand, communityCards, winnerText, gameFinished);
                     }
                 } else if (gameFinished && ui::isButtonClicked(nextRoundButton, sf::Vector2i(worldPos.x, worldPos.y)) && !player1Out && !player2Out) {
                     startNewRound(deck, player1Hand, player2Hand, communityCards, cardsToShow,
                                   player1score, player2score, player1BetDisplay, player2BetDisplay, pot,
                                   finalStakePhase, gameFinished, riverBettingPhase, winnerText, winner, allInPhase);
+                    pendingAI.cancel();
                     lastCardsToShowState = -1;
                 } else if (gameFinished && ui::isButtonClicked(playAgainButton, sf::Vector2i(worldPos.x, worldPos.y))) {
                     player1score = DEFAULT_STACK; player2score = DEFAULT_STACK; pot = 0; pendingStake = 0;
@@ -269,16 +372,38 @@ int main() {
                     player1Out = player2Out = gameFinished = allInPhase = riverBettingPhase = finalStakePhase = false;
                     cardsToShow = 0;
                     player1Hand = Hand(); player2Hand = Hand(); communityCards.clear();
-                    deck.reset(); deck.shuffle();
                     startNewRound(deck, player1Hand, player2Hand, communityCards, cardsToShow,
                                   player1score, player2score, player1BetDisplay, player2BetDisplay, pot,
                                   finalStakePhase, gameFinished, riverBettingPhase, winnerText, winner, allInPhase);
+                    pendingAI.cancel();
+                    lastCardsToShowState = -1;
                 } else if (gameFinished && ui::isButtonClicked(quitButton, sf::Vector2i(worldPos.x, worldPos.y))) {
                     window.close();
                 }
             }
         }
 
+        // Apply the AI's move once its background evaluation has finished
+        if (pendingAI.active() && pendingAI.task.ready()) {
+            const EquityResult decision = pendingAI.task.get();
+            const double winChance = decision.win;
+            const uint64_t decidedNs = Profiler::nowNs();
+            if (Profiler::enabled()) Profiler::record("ai/decision", pendingAI.startedNs, decidedNs);
+            aiDecisionLatency.record(decidedNs - pendingAI.startedNs);
+            lastAIDecisionMs = (decidedNs - pendingAI.startedNs) / 1e6;
+            lastSimulationsPerSecond = lastAIDecisionMs > 0.0 ? decision.samples / (lastAIDecisionMs / 1e3) : 0.0;
+            const auto kind = pendingAI.kind;
+            pendingAI = PendingAIDecision();
+            if (kind == PendingAIDecision::Kind::RespondToBet)
+                finishAIBetResponse(winChance, player1score, player2score, player1BetDisplay, player2BetDisplay, pot,
+                                    allInPhase, cardsToShow, riverBettingPhase, finalStakePhase,
+                                    winnerText, gameFinished, winner, player1Name, player2Name);
+            else
+                finishAICheckResponse(winChance, cardsToShow, riverBettingPhase, finalStakePhase,
+                                      player1score, player2score, player1BetDisplay, player2BetDisplay, pot,
+                                      allInPhase, winnerText, gameFinished, player2Name);
+        }
+
         if (finalStakePhase && !gameFinished) {
             cardsToShow = 5;
             gameFinished = true;
@@ -298,14 +423,14 @@ int main() {
                 winnerText = "Game Over! " + player1Name + " Wins!";
         }
 
-        updateAIInfo(ai, player2Hand, communityCards, cardsToShow, lastP2WinPercentage, lastCardsToShowState);
+        updateAIInfo(ai, infoTask, infoSamples, player2Hand, communityCards, cardsToShow, lastP2WinPercentage, lastCardsToShowState);
 
         // Buttons to show
         activeButtons.clear();
         if (overallGameFinished) {
             activeButtons.push_back(&playAgainButton);
             activeButtons.push_back(&quitButton);
-        } else if (!gameFinished && !player1Out && !player2Out) {
+        } else if (!gameFinished && !player1Out && !player2Out && !pendingAI.active()) {
             activeButtons.push_back(&submitButton);
             activeButtons.push_back(&add10Button);
             activeButtons.push_back(&add50Button);
@@ -320,22 +445,42 @@ int main() {
             activeButtons.push_back(&quitButton);
         }
 
-        // Render
-        window.clear(sf::Color(0, 75, 0));
-        window.setView(mainView);
-
-        ui::drawGameElements(window, font,
-                             player1Hand, player2Hand,
-                             communityCards, cardsToShow,
-                             player1BetDisplay, player2BetDisplay, pendingStake, pot,
-                             player1score, player2score,
-                             gameFinished, winnerText,
-                             activeButtons,
-                             lastP2WinPercentage,
-                             player1Name, player2Name,
-                             LOGICAL_WIDTH, LOGICAL_HEIGHT);
+        if (gameFinished != roundCounted) { // Count each hand once, when it ends
+            if (gameFinished) {
+                handsPlayed.add();
+                logFinishedHand(player1score, player2score);
+            }
+            roundCounted = gameFinished;
+        }
 
-        window.display();
+        redraw |= table.update(player1Hand, player2Hand,
+                               communityCards, cardsToShow,
+                               player1BetDisplay, player2BetDisplay, pendingStake, pot,
+                               player1score, player2score,
+                               gameFinished, winnerText, pendingAI.active(),
+                               activeButtons);
+
+        // Render only when something changed
+        if (redraw) {
+            overlay.setStats(lastFrameMs, lastAIDecisionMs, lastSimulationsPerSecond);
+            window.clear(sf::Color(0, 75, 0));
+            window.setView(mainView);
+            table.draw(window);
+            overlay.draw(window);
+
+            // Frame time is the work before display(), which also waits out the frame rate limit
+            const uint64_t frameEnd = Profiler::nowNs();
+            if (Profiler::enabled()) Profiler::record("main/frame", frameStart, frameEnd);
+            frameTime.record(frameEnd - frameStart);
+            lastFrameMs = (frameEnd - frameStart) / 1e6;
+            {
+                PROFILE_SCOPE("window.display");
+                window.display();
+            }
+            redraw = false;
+        } else if (busy) {
+            sf::sleep(sf::milliseconds(10));
+        }
     }
     return 0;
 }
@@ -348,17 +493,30 @@ void startNewRound(Deck& deck, Hand& player1Hand, Hand& player2Hand, std::vector
                    int& player1BetDisplay, int& player2BetDisplay, int& pot,
                    bool& finalStakePhase, bool& gameFinished, bool& riverBettingPhase,
                    std::string& winnerText, int& winner, bool& allInPhase) {
-    deck.reset();
-    deck.shuffle();
+    // Only the nine cards in play are drawn, from a fresh seed the hand history can replay
+    const uint64_t seed = Rng::randomSeed();
+    deck = Deck(seed);
+    int dealt[9];
+    deck.dealExcluding(CardSet(), 9, dealt);
+    currentHand = HandRecord();
+    currentHand.seed = seed;
+    currentHand.handNumber = handNumber++;
+    currentHand.startingStacks[0] = player1score;
+    currentHand.startingStacks[1] = player2score;
+    currentHand.blind = BLIND_AMOUNT;
+    currentHand.configs[1] = aiConfig.id(); // Seat 0 stays HandRecord::HUMAN
+    currentHand.outcome = static_cast<uint8_t>(GameState::Phase::Showdown);
+    for (int i = 0; i < 4; ++i) currentHand.holes[i % 2][i / 2] = static_cast<uint8_t>(dealt[i]);
+    for (int i = 0; i < 5; ++i) currentHand.board[i] = static_cast<uint8_t>(dealt[4 + i]);
     player1Hand = Hand(); 
     player2Hand = Hand();
     for (int i = 0; i < 2; ++i) {
-        player1Hand.addCard(deck.draw());
-        player2Hand.addCard(deck.draw());
+        player1Hand.addCard(Card::fromIndex(dealt[2 * i]));
+        player2Hand.addCard(Card::fromIndex(dealt[2 * i + 1]));
     }
     communityCards.clear();
-    for (int i = 0; i < 5; ++i)
-        communityCards.push_back(deck.draw());
+    for (int i = 4; i < 9; ++i)
+        communityCards.push_back(Card::fromIndex(dealt[i]));
 
     cardsToShow = 0;
     player1BetDisplay = 0;
@@ -419,13 +577,12 @@ void determineAndSetWinner(Hand& player1Hand, Hand& player2Hand, const std::vect
     if (player2score <= 0) player2Out = true;
 }
 
-void handlePlayerBetAction(playerAI& ai,
-                           int& pendingStake, int& player1score, int& player2score,
-                           int& player1BetDisplay, int& player2BetDisplay, int& pot,
-                           bool& allInPhase, size_t& cardsToShow, bool& riverBettingPhase, bool& finalStakePhase,
+void handlePlayerBetAction(playerAI& ai, PendingAIDecision& pendingAI,
+                           int& pendingStake, int& player1score,
+                           int& player1BetDisplay, int player2BetDisplay, int& pot,
+                           bool& allInPhase, size_t cardsToShow,
                            const Hand& player2Hand, const std::vector<Card>& communityCards,
-                           std::string& winnerText, bool& gameFinished, int& winner,
-                           const std::string& player1Name, const std::string& player2Name) {
+                           std::string& winnerText, bool gameFinished) {
     // Normalize to at least call if under-bet
     int p1TotalBetForStreet = pendingStake; 
     int p1AdditionalBet = p1TotalBetForStreet - player1BetDisplay;
@@ -439,80 +596,81 @@ void handlePlayerBetAction(playerAI& ai,
     pot         += p1AdditionalBet;
     player1BetDisplay += p1AdditionalBet;
     pendingStake = 0;
+    const Action::Type type = p1AdditionalBet == 0 ? Action::Type::Check
+                            : player1BetDisplay <= player2BetDisplay ? Action::Type::Call
+                            : player2BetDisplay > 0 ? Action::Type::Raise : Action::Type::Bet;
+    recordAction(0, cardsToShow, Action{type, p1AdditionalBet});
     if (player1score == 0) allInPhase = true;
 
     winnerText = "You bet to " + std::to_string(player1BetDisplay) + ".";
 
     if (gameFinished) return;
 
-    const int amountForAIToCall = player1BetDisplay - player2BetDisplay;
+    // The AI answers in finishAIBetResponse once its equity is ready
     const auto visibleBoard = makeVisibleBoard(communityCards, cardsToShow);
-    const double winChance = ai.evaluateHand(player2Hand, visibleBoard); 
+    pendingAI.kind = PendingAIDecision::Kind::RespondToBet;
+    pendingAI.task = ai.evaluateEquityAsync(player2Hand, visibleBoard);
+    pendingAI.startedNs = Profiler::nowNs();
+}
 
-    const float current_fold_threshold = computeCurrentFoldThreshold(amountForAIToCall, cardsToShow, player2score);
+void finishAIBetResponse(double winChance,
+                         int& player1score, int& player2score,
+                         int& player1BetDisplay, int& player2BetDisplay, int& pot,
+                         bool& allInPhase, size_t& cardsToShow, bool& riverBettingPhase, bool& finalStakePhase,
+                         std::string& winnerText, bool& gameFinished, int& winner,
+                         const std::string& player1Name, const std::string& player2Name) {
+    const int amountForAIToCall = player1BetDisplay - player2BetDisplay;
+    const Action action = AIPolicy::respondToBet(aiConfig, winChance, amountForAIToCall, player2score,
+                                                   player1BetDisplay, pot, cardsToShow, aiRng);
+    recordAction(1, cardsToShow, action);
 
-    int aiActionAmount = 0; 
-    if (amountForAIToCall > 0) {
-        if (winChance < current_fold_threshold && player2score > amountForAIToCall) {
-            gameFinished = true;
-            winner = 0;
-            winnerText += " " + player2Name + " folds. " + player1Name + " wins!";
-            player1score += pot; 
-            pot = 0;
-        } else if (winChance < AI_RAISE_THRESHOLD || amountForAIToCall >= player2score) { 
-            aiActionAmount = std::min(amountForAIToCall, player2score);
-            player2score -= aiActionAmount;
-            pot += aiActionAmount;
-            player2BetDisplay += aiActionAmount;
-            winnerText += " " + player2Name + " calls " + std::to_string(aiActionAmount) + ".";
-            if (player2score == 0) allInPhase = true;
-            if (!allInPhase && !gameFinished)
-                advanceGamePhase(cardsToShow, riverBettingPhase, finalStakePhase, player1BetDisplay, player2BetDisplay);
-        } else { 
-            const int aiCallPart = std::min(amountForAIToCall, player2score);
-            const int aiCanRaiseMax = player2score - aiCallPart;
-            if (aiCanRaiseMax > 0) {
-                int aiRaisePart = std::min({player1BetDisplay, pot / 2, aiCanRaiseMax}); 
-                if (aiRaisePart <= 0) aiRaisePart = std::min(50, aiCanRaiseMax); // Ensure some raise if possible
-                aiActionAmount = aiCallPart + aiRaisePart;
-                player2score -= aiActionAmount;
-                pot += aiActionAmount;
-                player2BetDisplay += aiActionAmount;
-                winnerText += " " + player2Name + " raises to " + std::to_string(player2BetDisplay) + ".";
-                if (player2score == 0) allInPhase = true;
-            } else { 
-                aiActionAmount = std::min(amountForAIToCall, player2score);
-                player2score -= aiActionAmount;
-                pot += aiActionAmount;
-                player2BetDisplay += aiActionAmount;
-                winnerText += " " + player2Name + " calls " + std::to_string(aiActionAmount) + ".";
-                if (player2score == 0) allInPhase = true;
-                if (!allInPhase && !gameFinished)
-                    advanceGamePhase(cardsToShow, riverBettingPhase, finalStakePhase, player1BetDisplay, player2BetDisplay);
-            }
-        }
-    } else { // amountForAIToCall <= 0
+    switch (action.type) {
+    case Action::Type::Fold:
+        gameFinished = true;
+        winner = 0;
+        winnerText += " " + player2Name + " folds. " + player1Name + " wins!";
+        player1score += pot;
+        pot = 0;
+        break;
+    case Action::Type::Call:
+        player2score -= action.amount;
+        pot += action.amount;
+        player2BetDisplay += action.amount;
+        winnerText += " " + player2Name + " calls " + std::to_string(action.amount) + ".";
+        if (player2score == 0) allInPhase = true;
+        if (!allInPhase && !gameFinished)
+            advanceGamePhase(cardsToShow, riverBettingPhase, finalStakePhase, player1BetDisplay, player2BetDisplay);
+        break;
+    case Action::Type::Raise:
+        player2score -= action.amount;
+        pot += action.amount;
+        player2BetDisplay += action.amount;
+        winnerText += " " + player2Name + " raises to " + std::to_string(player2BetDisplay) + ".";
+        if (player2score == 0) allInPhase = true;
+        break;
+    default: // Nothing to call
         if (player1BetDisplay == player2BetDisplay) {
-             winnerText += " Stakes are even.";
-             if (!allInPhase && !gameFinished)
+            winnerText += " Stakes are even.";
+            if (!allInPhase && !gameFinished)
                 advanceGamePhase(cardsToShow, riverBettingPhase, finalStakePhase, player1BetDisplay, player2BetDisplay);
         }
+        break;
     }
 
     enterAllInIfNeeded(gameFinished, player1score, player2score, allInPhase, cardsToShow, riverBettingPhase, finalStakePhase);
 }
 
-void handlePlayerWaitAction(playerAI& ai, 
+void handlePlayerWaitAction(playerAI& ai, PendingAIDecision& pendingAI,
                             size_t& cardsToShow, bool& riverBettingPhase, bool& finalStakePhase,
                             int& player1score, int& player2score,
                             int& player1BetDisplay, int& player2BetDisplay, int& pot,
                             bool& allInPhase,
                             const Hand& player2Hand, const std::vector<Card>& communityCards,
-                            std::string& winnerText, bool& gameFinished, int& winner,
-                            const std::string& player1Name, const std::string& player2Name) {
+                            std::string& winnerText, bool& gameFinished) {
     if (player1BetDisplay < player2BetDisplay) { 
         const int amountToCall = player2BetDisplay - player1BetDisplay;
         const int p1ActualCall = std::min(amountToCall, player1score);
+        recordAction(0, cardsToShow, Action{Action::Type::Call, p1ActualCall});
         player1score -= p1ActualCall;
         pot += p1ActualCall;
         player1BetDisplay += p1ActualCall;
@@ -522,28 +680,36 @@ void handlePlayerWaitAction(playerAI& ai,
             advanceGamePhase(cardsToShow, riverBettingPhase, finalStakePhase, player1BetDisplay, player2BetDisplay);
     } else { 
         winnerText = "You check.";
+        recordAction(0, cardsToShow, Action{Action::Type::Check, 0});
+        // The AI answers in finishAICheckResponse once its equity is ready
         const auto visibleBoard = makeVisibleBoard(communityCards, cardsToShow);
-        const double winChance = ai.evaluateHand(player2Hand, visibleBoard);
-
-        if (winChance > AI_RAISE_THRESHOLD && player2score > 0) {
-            int aiBetAmount = std::min({pot / 2, player2score / 2, player2score}); 
-            if (aiBetAmount <= 0) aiBetAmount = std::min(50, player2score);
-            if (aiBetAmount > 0) {
-                player2score -= aiBetAmount;
-                pot += aiBetAmount;
-                player2BetDisplay += aiBetAmount;
-                winnerText += " " + player2Name + " bets " + std::to_string(aiBetAmount) + ".";
-                if (player2score == 0) allInPhase = true;
-            } else { 
-                 winnerText += " " + player2Name + " checks.";
-                 if (!allInPhase && !gameFinished)
-                    advanceGamePhase(cardsToShow, riverBettingPhase, finalStakePhase, player1BetDisplay, player2BetDisplay);
-            }
-        } else {
-            winnerText += " " + player2Name + " checks.";
-            if (!allInPhase && !gameFinished)
-                advanceGamePhase(cardsToShow, riverBettingPhase, finalStakePhase, player1BetDisplay, player2BetDisplay);
-        }
+        pendingAI.kind = PendingAIDecision::Kind::RespondToCheck;
+        pendingAI.task = ai.evaluateEquityAsync(player2Hand, visibleBoard);
+        pendingAI.startedNs = Profiler::nowNs();
+        return;
+    }
+
+    enterAllInIfNeeded(gameFinished, player1score, player2score, allInPhase, cardsToShow, riverBettingPhase, finalStakePhase);
+}
+
+void finishAICheckResponse(double winChance,
+                           size_t& cardsToShow, bool& riverBettingPhase, bool& finalStakePhase,
+                           int& player1score, int& player2score,
+                           int& player1BetDisplay, int& player2BetDisplay, int& pot,
+                           bool& allInPhase, std::string& winnerText, bool& gameFinished,
+                           const std::string& player2Name) {
+    const Action action = AIPolicy::respondToCheck(aiConfig, winChance, player2score, pot);
+    recordAction(1, cardsToShow, action);
+    if (action.type == Action::Type::Bet) {
+        player2score -= action.amount;
+        pot += action.amount;
+        player2BetDisplay += action.amount;
+        winnerText += " " + player2Name + " bets " + std::to_string(action.amount) + ".";
+        if (player2score == 0) allInPhase = true;
+    } else {
+        winnerText += " " + player2Name + " checks.";
+        if (!allInPhase && !gameFinished)
+            advanceGamePhase(cardsToShow, riverBettingPhase, finalStakePhase, player1BetDisplay, player2BetDisplay);
     }
 
     enterAllInIfNeeded(gameFinished, player1score, player2score, allInPhase, cardsToShow, riverBettingPhase, finalStakePhase);
@@ -557,11 +723,19 @@ void handlePlayerPassAction(bool& gameFinished, int& winner, std::string& winner
     pot = 0;
 }
 
-void updateAIInfo(playerAI& ai, const Hand& player2Hand, const std::vector<Card>& communityCards, size_t cardsToShow,
+void updateAIInfo(playerAI& ai, EquityTask& infoTask, EquitySamples& infoSamples,
+                  const Hand& player2Hand, const std::vector<Card>& communityCards, size_t cardsToShow,
                   double& lastP2WinPercentage, int& lastCardsToShowState) {
+    PROFILE_SCOPE("main/updateAIInfo");
     if (static_cast<int>(cardsToShow) != lastCardsToShowState) {
+        // New street or new round: whatever is still running is stale
+        infoTask.cancel();
         const auto visibleBoard = makeVisibleBoard(communityCards, cardsToShow);
-        lastP2WinPercentage = ai.evaluateHand(player2Hand, visibleBoard) * 100.0;
+        infoTask = ai.refineEquityAsync(infoSamples, player2Hand, visibleBoard);
         lastCardsToShowState = static_cast<int>(cardsToShow);
     }
+    if (infoTask.ready()) {
+        lastP2WinPercentage = infoTask.get().win * 100.0;
+        infoTask = EquityTask();
+    }
 }
@@ -0,0 +1,34 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+
+// Read-only memory mapping of a whole file (mmap on POSIX, MapViewOfFile on Windows)
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    bool open(const std::string& path); // false if missing, empty or unmappable
+    void close();
+
+    bool isOpen() const;
+    const unsigned char* data() const;
+    size_t size() const;
+
+private:
+    const unsigned char* data_ = nullptr;
+    size_t size_ = 0;
+#ifdef _WIN32
+    void* fileHandle_ = nullptr;
+    void* mappingHandle_ = nullptr;
+#endif
+};
+
+#endif // MAPPEDFILE_H
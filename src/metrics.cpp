@@ -0,0 +1,191 @@
+#include "metrics.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+struct Entry {
+    std::string name;
+    std::string help;
+    Counter* counter = nullptr;
+    Histogram* histogram = nullptr;
+};
+
+// Leaked on purpose: pool threads may still update metrics while statics are destroyed
+struct Registry {
+    std::mutex mutex;
+    std::deque<Counter> counters;     // Deques keep references stable as they grow
+    std::deque<Histogram> histograms;
+    std::deque<Entry> entries;        // Registration order, the export order
+};
+
+Registry& registry() {
+    static Registry* instance = new Registry();
+    return *instance;
+}
+
+Entry* findEntry(Registry& r, const std::string& name) {
+    for (Entry& entry : r.entries) {
+        if (entry.name == name) return &entry;
+    }
+    return nullptr;
+}
+
+int highestBit(uint64_t value) {
+    int bit = 0;
+    while (value >>= 1) ++bit;
+    return bit;
+}
+
+} // namespace
+
+int Histogram::bucketOf(uint64_t value) {
+    if (value < 2 * SUB_BUCKETS) return static_cast<int>(value);
+    const int shift = highestBit(value) - 4; // Keeps the top five bits: 16..31
+    return shift * SUB_BUCKETS + static_cast<int>(value >> shift);
+}
+
+uint64_t Histogram::bucketLow(int bucket) {
+    if (bucket < 2 * SUB_BUCKETS) return static_cast<uint64_t>(bucket);
+    const int shift = bucket / SUB_BUCKETS - 1;
+    return static_cast<uint64_t>(bucket % SUB_BUCKETS + SUB_BUCKETS) << shift;
+}
+
+uint64_t Histogram::bucketHigh(int bucket) {
+    if (bucket < 2 * SUB_BUCKETS) return static_cast<uint64_t>(bucket);
+    const int shift = bucket / SUB_BUCKETS - 1;
+    return bucketLow(bucket) + ((uint64_t(1) << shift) - 1);
+}
+
+void Histogram::record(uint64_t value) {
+    buckets_[bucketOf(value)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(value, std::memory_order_relaxed);
+}
+
+uint64_t Histogram::quantile(double q) const {
+    // Count from the buckets themselves: count_ may run ahead of them mid-record
+    uint64_t total = 0;
+    for (const auto& bucket : buckets_) total += bucket.load(std::memory_order_relaxed);
+    if (total == 0) return 0;
+
+    const double clamped = q < 0.0 ? 0.0 : (q > 1.0 ? 1.0 : q);
+    const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(clamped * total + 0.5));
+    uint64_t seen = 0;
+    for (int bucket = 0; bucket < NUM_BUCKETS; ++bucket) {
+        seen += buckets_[bucket].load(std::memory_order_relaxed);
+        if (seen >= rank) return bucketLow(bucket) + (bucketHigh(bucket) - bucketLow(bucket)) / 2;
+    }
+    return bucketHigh(NUM_BUCKETS - 1);
+}
+
+Counter& Metrics::counter(const std::string& name, const std::string& help) {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    if (Entry* entry = findEntry(r, name)) {
+        if (!entry->counter) throw std::logic_error("Metric " + name + " is not a counter");
+        return *entry->counter;
+    }
+    r.counters.emplace_back();
+    r.entries.push_back(Entry{name, help, &r.counters.back(), nullptr});
+    return r.counters.back();
+}
+
+Histogram& Metrics::latency(const std::string& name, const std::string& help) {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    if (Entry* entry = findEntry(r, name)) {
+        if (!entry->histogram) throw std::logic_error("Metric " + name + " is not a latency");
+        return *entry->histogram;
+    }
+    r.histograms.emplace_back();
+    r.entries.push_back(Entry{name, help, nullptr, &r.histograms.back()});
+    return r.histograms.back();
+}
+
+std::string Metrics::prometheusText() {
+    std::ostringstream out;
+    out.precision(9);
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    for (const Entry& entry : r.entries) {
+        out << "# HELP " << entry.name << ' ' << entry.help << '\n';
+        if (entry.counter) {
+            out << "# TYPE " << entry.name << " counter\n"
+                << entry.name << ' ' << entry.counter->value() << '\n';
+            continue;
+        }
+        const Histogram& h = *entry.histogram;
+        out << "# TYPE " << entry.name << " summary\n";
+        for (const char* q : {"0.5", "0.95", "0.99"})
+            out << entry.name << "{quantile=\"" << q << "\"} " << h.quantile(std::atof(q)) * 1e-9 << '\n';
+        out << entry.name << "_sum " << h.sum() * 1e-9 << '\n'
+            << entry.name << "_count " << h.count() << '\n';
+    }
+    return out.str();
+}
+
+bool Metrics::writePrometheus(const std::string& path) {
+    const std::string text = prometheusText();
+    if (path == "-") {
+        std::cout << text << std::flush;
+        return static_cast<bool>(std::cout);
+    }
+    const std::string tmpPath = path + ".tmp";
+    {
+        std::ofstream out(tmpPath, std::ios::trunc);
+        if (!out) return false;
+        out << text;
+        if (!out) {
+            out.close();
+            std::remove(tmpPath.c_str());
+            return false;
+        }
+    }
+    std::remove(path.c_str());
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        std::remove(tmpPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+MetricsExporter::MetricsExporter(std::string path, std::chrono::milliseconds interval)
+    : path_(std::move(path)), interval_(interval), thread_([this]() { run(); }) {}
+
+MetricsExporter::~MetricsExporter() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    thread_.join();
+    Metrics::writePrometheus(path_);
+}
+
+void MetricsExporter::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!wake_.wait_for(lock, interval_, [this]() { return stopping_; })) {
+        lock.unlock();
+        Metrics::writePrometheus(path_);
+        lock.lock();
+    }
+}
+
+std::unique_ptr<MetricsExporter> MetricsExporter::fromEnvironment() {
+    const char* path = std::getenv("POKER_METRICS");
+    if (!path || !*path) return nullptr;
+    double seconds = 10.0;
+    if (const char* interval = std::getenv("POKER_METRICS_INTERVAL")) {
+        const double parsed = std::atof(interval);
+        if (parsed > 0.0) seconds = parsed;
+    }
+    return std::make_unique<MetricsExporter>(path, std::chrono::milliseconds(static_cast<long long>(seconds * 1000)));
+}
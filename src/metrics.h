@@ -0,0 +1,113 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// Monotonic count; add() is one relaxed atomic increment
+class Counter {
+public:
+    void add(uint64_t n = 1) { value_.fetch_add(n, std::memory_order_relaxed); }
+    uint64_t value() const { return value_.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64_t> value_{0};
+};
+
+// HDR-style histogram of non-negative integers: 16 linear sub-buckets per
+// power of two (values below 32 exact), so any quantile is within about 3%
+// of the true value across the whole uint64_t range. record() is three
+// relaxed atomic increments and takes no lock.
+class Histogram {
+public:
+    static constexpr int SUB_BUCKETS = 16;
+    static constexpr int NUM_BUCKETS = 2 * SUB_BUCKETS + (64 - 5) * SUB_BUCKETS;
+
+    void record(uint64_t value);
+
+    uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+    uint64_t sum() const { return sum_.load(std::memory_order_relaxed); }
+
+    // Middle of the bucket holding the q-th value, q in [0, 1]; 0 when empty
+    uint64_t quantile(double q) const;
+
+    static int bucketOf(uint64_t value);
+    static uint64_t bucketLow(int bucket);
+    static uint64_t bucketHigh(int bucket);
+
+private:
+    std::array<std::atomic<uint64_t>, NUM_BUCKETS> buckets_{};
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> sum_{0};
+};
+
+// Records the nanoseconds between construction and destruction into a histogram
+class LatencyTimer {
+public:
+    explicit LatencyTimer(Histogram& histogram)
+        : histogram_(histogram), start_(std::chrono::steady_clock::now()) {}
+    ~LatencyTimer() {
+        histogram_.record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start_).count()));
+    }
+
+    LatencyTimer(const LatencyTimer&) = delete;
+    LatencyTimer& operator=(const LatencyTimer&) = delete;
+
+private:
+    Histogram& histogram_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+// Process-wide named metrics. Registering takes a lock and returns the same
+// object for the same name, so callers keep the reference (typically in a
+// static) and update it lock-free from then on. Names follow Prometheus
+// conventions: counters end in _total, latencies in _seconds.
+class Metrics {
+public:
+    static Counter& counter(const std::string& name, const std::string& help);
+
+    // Values are recorded in nanoseconds and exported in seconds
+    static Histogram& latency(const std::string& name, const std::string& help);
+
+    // Prometheus text exposition format; latencies as summaries with p50, p95 and p99
+    static std::string prometheusText();
+
+    // Whole snapshot to path ("-" for stdout), via a temporary file so readers
+    // never see a partial one. False if it cannot be written.
+    static bool writePrometheus(const std::string& path);
+};
+
+// Writes Metrics::writePrometheus(path) every interval on a background
+// thread, and once more when stopped
+class MetricsExporter {
+public:
+    MetricsExporter(std::string path, std::chrono::milliseconds interval);
+    ~MetricsExporter(); // Stops, writing a final snapshot
+
+    MetricsExporter(const MetricsExporter&) = delete;
+    MetricsExporter& operator=(const MetricsExporter&) = delete;
+
+    // $POKER_METRICS names the file ("-" for stdout), $POKER_METRICS_INTERVAL
+    // the seconds between dumps (default 10). Null when POKER_METRICS is unset.
+    static std::unique_ptr<MetricsExporter> fromEnvironment();
+
+private:
+    void run();
+
+    std::string path_;
+    std::chrono::milliseconds interval_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    bool stopping_ = false;
+    std::thread thread_;
+};
+
+#endif // METRICS_H
@@ -3,83 +3,800 @@
 #include "card.h"
 #include "comparer.h"
 #include "deck.h"
-#include <random>
+#include "evaluator.h"
+#include "metrics.h"
+#include "preflopTable.h"
+#include "profiler.h"
 #include <algorithm>
-#include <thread>
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+#include <string>
  
-double playerAI::evaluateHand(const Hand& hand, const std::vector<Card>& board) {
-    // Monte Carlo simulation to estimate win percentage (multithreaded)
-    int wins = 0;
-    int iterations = 100000;
-    int numThreads = std::thread::hardware_concurrency();
-    if (numThreads == 0) numThreads = 16; // fallback
-
-    std::vector<std::thread> threads;
-    std::vector<int> threadWins(numThreads, 0);
-
-    auto worker = [&](int tid) {
-        int localWins = 0;
-        for (int i = tid; i < iterations; i += numThreads) {
-            if (simulateWin(hand, board)) ++localWins;
+namespace {
+constexpr uint64_t SIMULATIONS_PER_CHUNK = 1024;
+constexpr size_t RUNOUTS_PER_CHUNK = 4;
+// Exact is used while it costs no more showdowns than default Monte Carlo would
+constexpr uint64_t DEFAULT_EXACT_THRESHOLD = 100000;
+
+// Showdown outcome codes: LOSS, WIN, or the number of hands splitting the pot
+constexpr int LOSS = 0;
+constexpr int WIN = 1;
+
+// Registered once; updates are relaxed atomic adds
+Counter& equityQueries = Metrics::counter("poker_equity_queries_total",
+                                          "Equity queries answered, cache and preflop table hits included");
+Counter& evaluateHandCalls = Metrics::counter("poker_evaluate_hand_calls_total", "playerAI::evaluateHand calls");
+Counter& simulationsRun = Metrics::counter("poker_simulations_total", "Showdowns simulated or enumerated");
+Counter& cacheHits = Metrics::counter("poker_equity_cache_hits_total", "Equity queries answered from the cache");
+Counter& cacheMisses = Metrics::counter("poker_equity_cache_misses_total", "Equity queries the cache could not answer");
+Histogram& queryLatency = Metrics::latency("poker_equity_query_seconds", "Time to answer one equity query");
+
+struct OutcomeCounts {
+    uint64_t wins = 0;
+    uint64_t losses = 0;
+    uint64_t splits[MAX_OPPONENTS + 2] = {}; // splits[k]: pot shared k ways
+
+    void add(int outcome) {
+        if (outcome == WIN) ++wins;
+        else if (outcome == LOSS) ++losses;
+        else ++splits[outcome];
+    }
+    OutcomeCounts& operator+=(const OutcomeCounts& other) {
+        wins += other.wins;
+        losses += other.losses;
+        for (int k = 2; k <= MAX_OPPONENTS + 1; ++k) splits[k] += other.splits[k];
+        return *this;
+    }
+    uint64_t ties() const {
+        uint64_t sum = 0;
+        for (int k = 2; k <= MAX_OPPONENTS + 1; ++k) sum += splits[k];
+        return sum;
+    }
+    uint64_t total() const { return wins + ties() + losses; }
+};
+
+EquityResult toResult(const OutcomeCounts& counts, EquityResult::Method method) {
+    EquityResult result;
+    result.samples = counts.total();
+    result.method = method;
+    if (result.samples) {
+        const double n = static_cast<double>(result.samples);
+        result.win = counts.wins / n;
+        result.tie = counts.ties() / n;
+        result.lose = counts.losses / n;
+        // Each sample pays 1, 1/k for a k-way split, or 0 of the pot
+        double meanSquare = result.win;
+        for (int k = 2; k <= MAX_OPPONENTS + 1; ++k) {
+            result.tieShare += counts.splits[k] / (n * k);
+            meanSquare += counts.splits[k] / (n * k * k);
+        }
+        if (method == EquityResult::Method::MonteCarlo) {
+            const double mean = result.equity();
+            result.stdError = std::sqrt(std::max(0.0, meanSquare - mean * mean) / n);
+        }
+    }
+    return result;
+}
+
+// Monte Carlo in batches of chunks spread over the thread pool, until maxSamples,
+// the deadline, cancellation or the precision target. runChunk(chunk, count, rng)
+// returns the counts of one chunk of the batch; beginBatch(numChunks) and
+// endBatch() run on the calling thread around each batch. Chunks take streams
+// nextChunk, nextChunk + 1, ...; nextChunk is left past the last one used.
+template <typename BeginBatch, typename RunChunk, typename EndBatch>
+OutcomeCounts sampleInBatches(ThreadPool& pool, uint64_t seed, uint64_t& nextChunk, const EquityOptions& options,
+                              const std::atomic<bool>* cancel, OutcomeCounts total,
+                              BeginBatch&& beginBatch, RunChunk&& runChunk, EndBatch&& endBatch) {
+    using Clock = std::chrono::steady_clock;
+    const bool hasDeadline = options.timeBudget.count() > 0;
+    const Clock::time_point deadline = Clock::now() + options.timeBudget;
+
+    // Each chunk draws from its own stream keyed by its global index, so with
+    // no deadline the result does not depend on how chunks are spread over threads
+    const uint64_t chunksPerBatch = std::max<uint64_t>(1, (options.batchSize + SIMULATIONS_PER_CHUNK - 1) / SIMULATIONS_PER_CHUNK);
+    std::vector<OutcomeCounts> chunkCounts;
+    bool stop = options.targetStdError > 0.0 && total.total() > 0 &&
+                toResult(total, EquityResult::Method::MonteCarlo).stdError <= options.targetStdError;
+    while (!stop && total.total() < options.maxSamples) {
+        uint64_t remaining = options.maxSamples - total.total();
+        if (options.targetStdError > 0.0 && total.total() > 0) {
+            // Aim at the estimated shortfall so a few missing samples do not cost a whole batch
+            const EquityResult sofar = toResult(total, EquityResult::Method::MonteCarlo);
+            const double variance = sofar.stdError * sofar.stdError * total.total();
+            const double needed = std::ceil(variance / (options.targetStdError * options.targetStdError));
+            if (needed > total.total())
+                remaining = std::min<uint64_t>(remaining, static_cast<uint64_t>(needed) - total.total());
+        }
+        const uint64_t numChunks = std::min(chunksPerBatch, (remaining + SIMULATIONS_PER_CHUNK - 1) / SIMULATIONS_PER_CHUNK);
+        chunkCounts.assign(numChunks, OutcomeCounts());
+        beginBatch(static_cast<size_t>(numChunks));
+        const uint64_t firstChunk = nextChunk;
+        pool.parallelFor(numChunks, [&](size_t chunk) {
+            PROFILE_SCOPE("equity/monteCarloChunk");
+            // Past the deadline the rest of the batch is skipped, capping latency at one chunk
+            if (hasDeadline && Clock::now() >= deadline) return;
+            if (cancel && *cancel) return;
+            const uint64_t count = std::min(SIMULATIONS_PER_CHUNK, remaining - chunk * SIMULATIONS_PER_CHUNK);
+            Rng rng = Rng::forStream(seed, firstChunk + chunk);
+            chunkCounts[chunk] = runChunk(chunk, count, rng);
+        });
+        nextChunk += numChunks;
+        OutcomeCounts batch;
+        for (const auto& c : chunkCounts) batch += c;
+        total += batch;
+        simulationsRun.add(batch.total());
+        endBatch();
+
+        if (hasDeadline && Clock::now() >= deadline) break;
+        if (cancel && *cancel) break;
+        if (options.targetStdError > 0.0 &&
+            toResult(total, EquityResult::Method::MonteCarlo).stdError <= options.targetStdError) break;
+    }
+    return total;
+}
+
+uint64_t choose(int n, int k) {
+    if (k < 0 || k > n) return 0;
+    uint64_t result = 1;
+    for (int i = 1; i <= k; ++i) result = result * (n - k + i) / i;
+    return result;
+}
+
+// Calls fn(set) for every k-card subset of cards[0..n)
+template <typename Fn>
+void forEachCombination(const int* cards, int n, int k, CardSet chosen, Fn&& fn) {
+    if (k == 0) {
+        fn(chosen);
+        return;
+    }
+    for (int i = 0; i + k <= n; ++i) {
+        CardSet next = chosen;
+        next.add(cards[i]);
+        forEachCombination(cards + i + 1, n - i - 1, k - 1, next, fn);
+    }
+}
+void checkOpponents(const EquityOptions& options) {
+    if (options.opponents < 1 || options.opponents > MAX_OPPONENTS)
+        throw std::invalid_argument("Opponent count must be 1.." + std::to_string(MAX_OPPONENTS));
+}
+
+// Showdowns are dealt a block at a time and evaluated with one Evaluator::evaluateBatch call
+constexpr int SHOWDOWNS_PER_BLOCK = 64;
+
+// One random runout and set of opponent hands: fills fullBoard and enemyHands[0..opponents)
+void dealShowdown(CardSet myHand, CardSet board, int opponents, Rng& rng, CardSet& fullBoard, CardSet* enemyHands) {
+    //All used cards are dead, live ones are found by rejection against the mask
+    CardSet dealt = myHand | board;
+    auto drawLive = [&]() {
+        for (;;) {
+            int index = static_cast<int>(rng.below(52));
+            if (!dealt.contains(index)) {
+                dealt.add(index);
+                return index;
+            }
         }
-        threadWins[tid] = localWins;
     };
 
-    for (int t = 0; t < numThreads; ++t) {
-        threads.emplace_back(worker, t);
+    //Fill board up to 5 cards
+    fullBoard = board;
+    while (fullBoard.size() < 5) fullBoard.add(drawLive());
+
+    //Draw 2 random cards per enemy
+    for (int i = 0; i < opponents; ++i) {
+        enemyHands[i] = CardSet();
+        enemyHands[i].add(drawLive());
+        enemyHands[i].add(drawLive());
     }
-    for (auto& th : threads) th.join();
+}
 
-    for (int w : threadWins) wins += w;
-    return static_cast<double>(wins) / iterations;
+// Outcome code for strengths[0] against strengths[1..opponents]
+int showdownOutcome(const uint16_t* strengths, int opponents) {
+    int sharing = 1;
+    for (int i = 1; i <= opponents; ++i) {
+        if (strengths[i] > strengths[0]) return LOSS;
+        if (strengths[i] == strengths[0]) ++sharing;
+    }
+    return sharing; // WIN when nobody matched
+}
 
+// Holdings of a range that avoid the dead cards, with their weights
+struct LiveRange {
+    std::vector<CardSet> holdings;
+    std::vector<double> weights;
+};
+
+LiveRange liveHoldings(const Range& range, CardSet dead) {
+    LiveRange live;
+    for (int combo = 0; combo < Range::NUM_COMBOS; ++combo) {
+        const CardSet holding = Range::comboCards(combo);
+        if (range.weight(combo) > 0.0 && !holding.intersects(dead)) {
+            live.holdings.push_back(holding);
+            live.weights.push_back(range.weight(combo));
+        }
+    }
+    return live;
 }
-bool playerAI::simulateWin(Hand myHand, std::vector<Card> board) {
-    //Gather all used cards 
-    std::vector<Card> used;
-    for (const auto& c : myHand.getCards()) used.push_back(c);
-    for (const auto& c : board) used.push_back(c);
 
-    //Build deck of remaining cards
-    std::vector<Card> deck;
-    for (int suit = 0; suit < 4; ++suit) {
-        for (int rank = 2; rank <= 14; ++rank) {
-            Card candidate(static_cast<Card::Rank>(rank), static_cast<Card::Suit>(suit));
-            // Check if already used
-            bool found = false;
-            for (const auto& u : used) {
-                if (u.getRank() == candidate.getRank() && u.getSuit() == candidate.getSuit()) {
-                    found = true;
-                    break;
-                }
+// Vose's alias method: draws index i with probability weights[i] / sum in O(1)
+class AliasTable {
+public:
+    explicit AliasTable(const std::vector<double>& weights) : prob_(weights.size()), alias_(weights.size()) {
+        const size_t n = weights.size();
+        double sum = 0.0;
+        for (double w : weights) sum += w;
+        std::vector<double> scaled(n);
+        std::vector<uint32_t> small, large;
+        for (size_t i = 0; i < n; ++i) {
+            scaled[i] = weights[i] * n / sum;
+            (scaled[i] < 1.0 ? small : large).push_back(static_cast<uint32_t>(i));
+        }
+        while (!small.empty() && !large.empty()) {
+            const uint32_t less = small.back(), more = large.back();
+            small.pop_back();
+            prob_[less] = scaled[less];
+            alias_[less] = more;
+            scaled[more] -= 1.0 - scaled[less];
+            if (scaled[more] < 1.0) {
+                large.pop_back();
+                small.push_back(more);
             }
-            if (!found) deck.push_back(candidate);
         }
+        // Leftovers are 1 up to rounding
+        for (uint32_t i : large) prob_[i] = 1.0;
+        for (uint32_t i : small) prob_[i] = 1.0;
     }
 
-    //Shuffle deck
-    static std::random_device rd;
-    static std::mt19937 rng(rd());
-    std::shuffle(deck.begin(), deck.end(), rng);
+    size_t draw(Rng& rng) const {
+        const uint32_t i = rng.below(static_cast<uint32_t>(prob_.size()));
+        return rng.nextDouble() < prob_[i] ? i : alias_[i];
+    }
 
-    //Fill board up to 5 cards
-    while (board.size() < 5 && !deck.empty()) {
-        board.push_back(deck.back());
-        deck.pop_back();
+private:
+    std::vector<double> prob_;
+    std::vector<uint32_t> alias_;
+};
+
+// Weight of all pairs of holdings that share no card
+double compatibleWeight(const LiveRange& hero, const LiveRange& villain) {
+    double total = 0.0;
+    for (size_t i = 0; i < hero.holdings.size(); ++i) {
+        for (size_t j = 0; j < villain.holdings.size(); ++j) {
+            if (!hero.holdings[i].intersects(villain.holdings[j])) total += hero.weights[i] * villain.weights[j];
+        }
     }
+    return total;
+}
+} // namespace
 
-    //Draw 2 random enemy cards
-    std::vector<Card> enemyHand;
-    for (int i = 0; i < 2 && !deck.empty(); ++i) {
-        enemyHand.push_back(deck.back());
-        deck.pop_back();
+void EquitySamples::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    hand_ = CardSet();
+    board_ = CardSet();
+    samples_.clear();
+    streamsUsed_ = 0;
+}
+
+size_t EquitySamples::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return samples_.size();
+}
+
+bool EquityTask::valid() const {
+    return state_ != nullptr;
+}
+
+bool EquityTask::ready() const {
+    return state_ && state_->result.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+EquityResult EquityTask::get() {
+    return state_->result.get();
+}
+
+void EquityTask::cancel() {
+    if (state_) state_->cancelled = true;
+}
+
+bool EquityTask::isCancelled() const {
+    return state_ && state_->cancelled;
+}
+
+playerAI::playerAI() : pool_(&ThreadPool::shared()), exactThreshold_(DEFAULT_EXACT_THRESHOLD) {}
+
+playerAI::playerAI(ThreadPool& pool) : pool_(&pool), exactThreshold_(DEFAULT_EXACT_THRESHOLD) {}
+
+playerAI::~playerAI() {
+    // Background tasks use this object, so stop them before it goes away
+    std::unique_lock<std::mutex> lock(tasksMutex_);
+    for (auto& weak : tasks_) {
+        if (auto state = weak.lock()) state->cancelled = true;
     }
+    tasksDone_.wait(lock, [&]() { return runningTasks_ == 0; });
+}
+
+ThreadPool& playerAI::getThreadPool() const {
+    return *pool_;
+}
+
+void playerAI::setSeed(uint64_t seed) {
+    seed_ = seed;
+}
 
-    //Build full hands
-    Hand myFull = myHand.combineHands(Hand{board});
-    Hand enemyFull = Hand(enemyHand).combineHands(Hand{board});
+uint64_t playerAI::getSeed() const {
+    return seed_;
+}
+
+uint64_t playerAI::getLastSeed() const {
+    return lastSeed_;
+}
+
+void playerAI::setCacheBudget(size_t bytes) {
+    cache_.setMemoryBudget(bytes);
+}
+
+EquityCache::Stats playerAI::getCacheStats() const {
+    return cache_.getStats();
+}
+
+void playerAI::clearCache() {
+    cache_.clear();
+}
+
+void playerAI::setExactThreshold(uint64_t showdowns) {
+    exactThreshold_ = showdowns;
+}
+
+uint64_t playerAI::getExactThreshold() const {
+    return exactThreshold_;
+}
+
+uint64_t playerAI::countShowdowns(CardSet hand, CardSet board) {
+    const int live = 52 - (hand | board).size();
+    const int missing = 5 - board.size();
+    return choose(live, missing) * choose(live - missing, 2);
+}
+
+void playerAI::setDefaultOptions(const EquityOptions& options) {
+    defaultOptions_ = options;
+}
+
+const EquityOptions& playerAI::getDefaultOptions() const {
+    return defaultOptions_;
+}
+
+EquityResult playerAI::evaluateEquity(const Hand& hand, const std::vector<Card>& board) {
+    return evaluateEquity(hand, board, defaultOptions_);
+}
 
-    //Compare
-    int cmp = Comparer::compareHands(myFull, enemyFull);
-    return cmp == 0; // true if myHand wins, false if loses or ties for simplicity
-}
\ No newline at end of file
+EquityResult playerAI::evaluateEquity(const Hand& hand, const std::vector<Card>& board, const EquityOptions& options) {
+    return computeEquity(hand.getCardSet(), CardSet(board), options, nullptr);
+}
+
+EquityTask playerAI::evaluateEquityAsync(const Hand& hand, const std::vector<Card>& board) {
+    return evaluateEquityAsync(hand, board, defaultOptions_);
+}
+
+EquityTask playerAI::evaluateEquityAsync(const Hand& hand, const std::vector<Card>& board, const EquityOptions& options) {
+    const CardSet handSet = hand.getCardSet();
+    const CardSet boardSet(board);
+    return submit([this, handSet, boardSet, options](const std::atomic<bool>* cancel) {
+        return computeEquity(handSet, boardSet, options, cancel);
+    });
+}
+
+EquityResult playerAI::refineEquity(EquitySamples& samples, const Hand& hand, const std::vector<Card>& board) {
+    return refineEquity(samples, hand, board, defaultOptions_);
+}
+
+EquityResult playerAI::refineEquity(EquitySamples& samples, const Hand& hand, const std::vector<Card>& board,
+                                    const EquityOptions& options) {
+    return computeRefinedEquity(samples, hand.getCardSet(), CardSet(board), options, nullptr);
+}
+
+EquityTask playerAI::refineEquityAsync(EquitySamples& samples, const Hand& hand, const std::vector<Card>& board) {
+    return refineEquityAsync(samples, hand, board, defaultOptions_);
+}
+
+EquityTask playerAI::refineEquityAsync(EquitySamples& samples, const Hand& hand, const std::vector<Card>& board,
+                                       const EquityOptions& options) {
+    const CardSet handSet = hand.getCardSet();
+    const CardSet boardSet(board);
+    EquitySamples* target = &samples;
+    return submit([this, target, handSet, boardSet, options](const std::atomic<bool>* cancel) {
+        return computeRefinedEquity(*target, handSet, boardSet, options, cancel);
+    });
+}
+
+EquityTask playerAI::submit(std::function<EquityResult(const std::atomic<bool>*)> query) {
+    EquityTask task;
+    task.state_ = std::make_shared<EquityTask::State>();
+    auto promise = std::make_shared<std::promise<EquityResult>>();
+    task.state_->result = promise->get_future();
+    {
+        std::lock_guard<std::mutex> lock(tasksMutex_);
+        tasks_.erase(std::remove_if(tasks_.begin(), tasks_.end(),
+                                    [](const std::weak_ptr<EquityTask::State>& w) { return w.expired(); }),
+                     tasks_.end());
+        tasks_.push_back(task.state_);
+        ++runningTasks_;
+    }
+
+    std::shared_ptr<EquityTask::State> state = task.state_;
+    pool_->submit([this, state, promise, query = std::move(query)]() {
+        try {
+            promise->set_value(query(&state->cancelled));
+        } catch (...) {
+            promise->set_exception(std::current_exception());
+        }
+        std::lock_guard<std::mutex> lock(tasksMutex_);
+        if (--runningTasks_ == 0) tasksDone_.notify_all();
+    });
+    return task;
+}
+
+EquityResult playerAI::computeEquity(CardSet hand, CardSet board, const EquityOptions& options,
+                                     const std::atomic<bool>* cancel) {
+    PROFILE_SCOPE("equity/query");
+    checkOpponents(options);
+    equityQueries.add();
+    LatencyTimer timer(queryLatency);
+    EquityResult tableResult;
+    if (options.usePreflopTable && board.empty() && PreflopTable::lookup(hand, options.opponents, tableResult))
+        return tableResult;
+
+    const EquityCache::Key key = EquityCache::canonicalKey(hand, board, options.opponents);
+    EquityResult result;
+    if (cache_.find(key, options, result)) {
+        cacheHits.add();
+        return result;
+    }
+    cacheMisses.add();
+    if (options.opponents == 1 && countShowdowns(hand, board) <= exactThreshold_)
+        result = exactEquity(hand, board, cancel);
+    else result = monteCarloEquity(hand, board, options, cancel);
+    if (!(cancel && *cancel)) cache_.insert(key, result);
+    return result;
+}
+
+EquityResult playerAI::computeRefinedEquity(EquitySamples& samples, CardSet hand, CardSet board,
+                                            const EquityOptions& options, const std::atomic<bool>* cancel) {
+    checkOpponents(options);
+    std::lock_guard<std::mutex> lock(samples.mutex_);
+
+    // Samples drawn for an earlier board of this hand are uniform over its
+    // completions; those that agree with the cards dealt since still are
+    if (samples.hand_ != hand || samples.opponents_ != options.opponents || !(samples.board_ - board).empty())
+        samples.samples_.clear();
+    samples.samples_.erase(std::remove_if(samples.samples_.begin(), samples.samples_.end(),
+                                          [&](const EquitySamples::Sample& sample) {
+                                              return !(board - sample.board).empty() ||
+                                                     sample.opponents.intersects(board);
+                                          }),
+                           samples.samples_.end());
+    samples.hand_ = hand;
+    samples.board_ = board;
+    samples.opponents_ = options.opponents;
+
+    // The preflop table and exact enumeration need no samples
+    EquityResult tableResult;
+    if (options.usePreflopTable && board.empty() && PreflopTable::lookup(hand, options.opponents, tableResult)) {
+        equityQueries.add();
+        return tableResult;
+    }
+    if (options.opponents == 1 && countShowdowns(hand, board) <= exactThreshold_)
+        return computeEquity(hand, board, options, cancel); // Counted there
+
+    equityQueries.add();
+    LatencyTimer timer(queryLatency);
+    const EquityCache::Key key = EquityCache::canonicalKey(hand, board, options.opponents);
+    EquityResult result;
+    if (cache_.find(key, options, result)) {
+        cacheHits.add();
+        return result;
+    }
+    cacheMisses.add();
+    result = monteCarloEquity(hand, board, options, cancel, &samples);
+    if (!(cancel && *cancel)) cache_.insert(key, result);
+    return result;
+}
+
+EquityResult playerAI::evaluateRangeEquity(const Hand& hand, const Range& villain, const std::vector<Card>& board) {
+    return evaluateRangeEquity(hand, villain, board, defaultOptions_);
+}
+
+EquityResult playerAI::evaluateRangeEquity(const Hand& hand, const Range& villain, const std::vector<Card>& board,
+                                           const EquityOptions& options) {
+    return evaluateRangeEquity(Range::single(hand.getCardSet()), villain, board, options);
+}
+
+EquityResult playerAI::evaluateRangeEquity(const Range& hero, const Range& villain, const std::vector<Card>& board) {
+    return evaluateRangeEquity(hero, villain, board, defaultOptions_);
+}
+
+EquityResult playerAI::evaluateRangeEquity(const Range& hero, const Range& villain, const std::vector<Card>& board,
+                                           const EquityOptions& options) {
+    const CardSet boardSet(board);
+    const LiveRange heroLive = liveHoldings(hero, boardSet);
+    const LiveRange villainLive = liveHoldings(villain, boardSet);
+    if (compatibleWeight(heroLive, villainLive) <= 0.0) return EquityResult(); // No possible matchup
+
+    // Exact evaluates every live holding once per runout; comparing a pair is
+    // far cheaper than an evaluation, so pairs count 1/16
+    const double h = static_cast<double>(heroLive.holdings.size());
+    const double v = static_cast<double>(villainLive.holdings.size());
+    const double runouts = static_cast<double>(choose(52 - boardSet.size(), 5 - boardSet.size()));
+    if (runouts * (h + v + h * v / 16.0) <= static_cast<double>(exactThreshold_))
+        return rangeExactEquity(hero, villain, boardSet);
+    return rangeMonteCarloEquity(hero, villain, boardSet, options);
+}
+
+double playerAI::evaluateHand(const Hand& hand, const std::vector<Card>& board, int opponents) {
+    evaluateHandCalls.add();
+    EquityOptions options = defaultOptions_;
+    options.opponents = opponents;
+    return evaluateEquity(hand, board, options).win; // ties count as a loss, as before
+}
+
+EquityResult playerAI::monteCarloEquity(CardSet hand, CardSet board, const EquityOptions& options,
+                                        const std::atomic<bool>* cancel, EquitySamples* samples) {
+    const uint64_t seed = seed_ ? seed_ : Rng::randomSeed();
+    lastSeed_ = seed;
+
+    // Streams already drawn for these samples would only replay the runouts
+    // and opponents that an earlier street filtered out
+    OutcomeCounts initial;
+    uint64_t nextChunk = 0;
+    if (samples) {
+        for (const auto& sample : samples->samples_) initial.add(sample.outcome);
+        nextChunk = samples->streamsUsed_;
+    }
+    std::vector<std::vector<EquitySamples::Sample>> chunkSamples;
+    const OutcomeCounts total = sampleInBatches(
+        *pool_, seed, nextChunk, options, cancel, initial,
+        [&](size_t numChunks) {
+            if (samples) chunkSamples.assign(numChunks, {});
+        },
+        [&](size_t chunk, uint64_t count, Rng& rng) {
+            // Hero then each opponent, per showdown of the block
+            const int stride = options.opponents + 1;
+            CardSet hands[SHOWDOWNS_PER_BLOCK * (MAX_OPPONENTS + 1)];
+            uint16_t strengths[SHOWDOWNS_PER_BLOCK * (MAX_OPPONENTS + 1)];
+            EquitySamples::Sample* kept = nullptr;
+            if (samples) {
+                chunkSamples[chunk].resize(count);
+                kept = chunkSamples[chunk].data();
+            }
+
+            OutcomeCounts local;
+            for (uint64_t done = 0; done < count; done += SHOWDOWNS_PER_BLOCK) {
+                const int n = static_cast<int>(std::min<uint64_t>(SHOWDOWNS_PER_BLOCK, count - done));
+                for (int i = 0; i < n; ++i) {
+                    CardSet* row = hands + i * stride;
+                    CardSet fullBoard;
+                    dealShowdown(hand, board, options.opponents, rng, fullBoard, row + 1);
+                    row[0] = hand | fullBoard;
+                    CardSet opponentCards;
+                    for (int j = 1; j < stride; ++j) {
+                        opponentCards |= row[j];
+                        row[j] |= fullBoard;
+                    }
+                    if (kept) {
+                        kept[done + i].board = fullBoard;
+                        kept[done + i].opponents = opponentCards;
+                    }
+                }
+                Evaluator::evaluateBatch(hands, static_cast<size_t>(n) * stride, strengths);
+                for (int i = 0; i < n; ++i) {
+                    const int outcome = showdownOutcome(strengths + i * stride, options.opponents);
+                    if (kept) kept[done + i].outcome = outcome;
+                    local.add(outcome);
+                }
+            }
+            return local;
+        },
+        [&]() {
+            if (samples) {
+                for (const auto& kept : chunkSamples)
+                    samples->samples_.insert(samples->samples_.end(), kept.begin(), kept.end());
+            }
+        });
+    if (samples) samples->streamsUsed_ = nextChunk;
+    return toResult(total, EquityResult::Method::MonteCarlo);
+}
+
+EquityResult playerAI::exactEquity(CardSet hand, CardSet board, const std::atomic<bool>* cancel) {
+    const CardSet live = (hand | board).complement();
+    int liveCards[52];
+    int numLive = 0;
+    live.forEach([&](int index) { liveCards[numLive++] = index; });
+
+    // Every way to complete the board, then every opponent holding on each
+    std::vector<CardSet> runouts;
+    runouts.reserve(choose(numLive, 5 - board.size()));
+    forEachCombination(liveCards, numLive, 5 - board.size(), CardSet(), [&](CardSet runout) {
+        runouts.push_back(runout);
+    });
+
+    const size_t numChunks = (runouts.size() + RUNOUTS_PER_CHUNK - 1) / RUNOUTS_PER_CHUNK;
+    std::vector<OutcomeCounts> chunkCounts(numChunks);
+    pool_->parallelFor(numChunks, [&](size_t chunk) {
+        PROFILE_SCOPE("equity/exactChunk");
+        if (cancel && *cancel) return;
+        size_t end = std::min(runouts.size(), (chunk + 1) * RUNOUTS_PER_CHUNK);
+        OutcomeCounts local;
+        std::vector<CardSet> enemies;
+        std::vector<uint16_t> strengths;
+        for (size_t r = chunk * RUNOUTS_PER_CHUNK; r < end; ++r) {
+            const CardSet fullBoard = board | runouts[r];
+            const uint16_t mine = Evaluator::evaluate(hand | fullBoard);
+
+            // Every opponent holding on this runout, evaluated as one batch
+            int opponentCards[52];
+            int numOpponentCards = 0;
+            (live - runouts[r]).forEach([&](int index) { opponentCards[numOpponentCards++] = index; });
+            enemies.clear();
+            for (int a = 0; a < numOpponentCards; ++a) {
+                CardSet withFirst = fullBoard;
+                withFirst.add(opponentCards[a]);
+                for (int b = a + 1; b < numOpponentCards; ++b) {
+                    CardSet enemy = withFirst;
+                    enemy.add(opponentCards[b]);
+                    enemies.push_back(enemy);
+                }
+            }
+            strengths.resize(enemies.size());
+            Evaluator::evaluateBatch(enemies.data(), enemies.size(), strengths.data());
+            for (uint16_t theirs : strengths) local.add(mine > theirs ? WIN : (mine == theirs ? 2 : LOSS));
+        }
+        chunkCounts[chunk] = local;
+    });
+
+    OutcomeCounts total;
+    for (const auto& c : chunkCounts) total += c;
+    simulationsRun.add(total.total());
+    return toResult(total, EquityResult::Method::Exact);
+}
+
+EquityResult playerAI::rangeMonteCarloEquity(const Range& hero, const Range& villain, CardSet board,
+                                             const EquityOptions& options) {
+    const uint64_t seed = seed_ ? seed_ : Rng::randomSeed();
+    lastSeed_ = seed;
+    const LiveRange heroLive = liveHoldings(hero, board);
+    const LiveRange villainLive = liveHoldings(villain, board);
+    const AliasTable heroTable(heroLive.weights);
+    const AliasTable villainTable(villainLive.weights);
+
+    uint64_t nextChunk = 0;
+    const OutcomeCounts total = sampleInBatches(
+        *pool_, seed, nextChunk, options, nullptr, OutcomeCounts(), [](size_t) {},
+        [&](size_t, uint64_t count, Rng& rng) {
+            CardSet hands[SHOWDOWNS_PER_BLOCK * 2];
+            uint16_t strengths[SHOWDOWNS_PER_BLOCK * 2];
+            OutcomeCounts local;
+            for (uint64_t done = 0; done < count; done += SHOWDOWNS_PER_BLOCK) {
+                const int n = static_cast<int>(std::min<uint64_t>(SHOWDOWNS_PER_BLOCK, count - done));
+                for (int i = 0; i < n; ++i) {
+                    // Both holdings by weight, redrawn together on overlap: card removal
+                    CardSet mine, theirs;
+                    do {
+                        mine = heroLive.holdings[heroTable.draw(rng)];
+                        theirs = villainLive.holdings[villainTable.draw(rng)];
+                    } while (mine.intersects(theirs));
+
+                    CardSet dealt = board | mine | theirs;
+                    CardSet fullBoard = board;
+                    while (fullBoard.size() < 5) {
+                        const int index = static_cast<int>(rng.below(52));
+                        if (!dealt.contains(index)) {
+                            dealt.add(index);
+                            fullBoard.add(index);
+                        }
+                    }
+                    hands[2 * i] = mine | fullBoard;
+                    hands[2 * i + 1] = theirs | fullBoard;
+                }
+                Evaluator::evaluateBatch(hands, static_cast<size_t>(n) * 2, strengths);
+                for (int i = 0; i < n; ++i) local.add(showdownOutcome(strengths + 2 * i, 1));
+            }
+            return local;
+        },
+        []() {});
+    return toResult(total, EquityResult::Method::MonteCarlo);
+}
+
+EquityResult playerAI::rangeExactEquity(const Range& hero, const Range& villain, CardSet board) {
+    const LiveRange heroLive = liveHoldings(hero, board);
+    const LiveRange villainLive = liveHoldings(villain, board);
+    int liveCards[52];
+    int numLive = 0;
+    board.complement().forEach([&](int index) { liveCards[numLive++] = index; });
+
+    std::vector<CardSet> runouts;
+    runouts.reserve(choose(numLive, 5 - board.size()));
+    forEachCombination(liveCards, numLive, 5 - board.size(), CardSet(), [&](CardSet runout) {
+        runouts.push_back(runout);
+    });
+
+    // Every pair of disjoint holdings has the same number of runouts avoiding
+    // both, so weighting each (pair, runout) by the pair's weight is exact
+    struct WeightedCounts {
+        double win = 0.0, tie = 0.0, lose = 0.0;
+        uint64_t showdowns = 0;
+    };
+    const size_t numChunks = (runouts.size() + RUNOUTS_PER_CHUNK - 1) / RUNOUTS_PER_CHUNK;
+    std::vector<WeightedCounts> chunkCounts(numChunks);
+    pool_->parallelFor(numChunks, [&](size_t chunk) {
+        PROFILE_SCOPE("equity/rangeExactChunk");
+        std::vector<uint16_t> heroStrength(heroLive.holdings.size());
+        std::vector<uint16_t> villainStrength(villainLive.holdings.size());
+        std::vector<CardSet> hands;
+        const size_t end = std::min(runouts.size(), (chunk + 1) * RUNOUTS_PER_CHUNK);
+        WeightedCounts local;
+        auto evaluateAll = [&](const LiveRange& live, const CardSet& runout, std::vector<uint16_t>& strengths) {
+            hands.resize(live.holdings.size());
+            for (size_t i = 0; i < hands.size(); ++i) hands[i] = live.holdings[i] | board | runout;
+            Evaluator::evaluateBatch(hands.data(), hands.size(), strengths.data());
+            // Strength 0 marks a holding the runout uses
+            for (size_t i = 0; i < hands.size(); ++i) {
+                if (live.holdings[i].intersects(runout)) strengths[i] = 0;
+            }
+        };
+        for (size_t r = chunk * RUNOUTS_PER_CHUNK; r < end; ++r) {
+            evaluateAll(heroLive, runouts[r], heroStrength);
+            evaluateAll(villainLive, runouts[r], villainStrength);
+
+            for (size_t i = 0; i < heroStrength.size(); ++i) {
+                if (!heroStrength[i]) continue;
+                const CardSet mine = heroLive.holdings[i];
+                for (size_t j = 0; j < villainStrength.size(); ++j) {
+                    if (!villainStrength[j] || mine.intersects(villainLive.holdings[j])) continue;
+                    const double w = heroLive.weights[i] * villainLive.weights[j];
+                    if (heroStrength[i] > villainStrength[j]) local.win += w;
+                    else if (heroStrength[i] == villainStrength[j]) local.tie += w;
+                    else local.lose += w;
+                    ++local.showdowns;
+                }
+            }
+        }
+        chunkCounts[chunk] = local;
+    });
+
+    WeightedCounts total;
+    for (const auto& c : chunkCounts) {
+        total.win += c.win;
+        total.tie += c.tie;
+        total.lose += c.lose;
+        total.showdowns += c.showdowns;
+    }
+    simulationsRun.add(total.showdowns);
+    EquityResult result;
+    result.method = EquityResult::Method::Exact;
+    result.samples = total.showdowns;
+    const double sum = total.win + total.tie + total.lose;
+    if (sum > 0.0) {
+        result.win = total.win / sum;
+        result.tie = total.tie / sum;
+        result.lose = total.lose / sum;
+        result.tieShare = result.tie / 2.0;
+    }
+    return result;
+}
+
+bool playerAI::simulateWin(const Hand& myHand, const std::vector<Card>& board) {
+    thread_local Rng rng(Rng::randomSeed());
+    return simulateWin(myHand.getCardSet(), CardSet(board), rng);
+}
+
+bool playerAI::simulateWin(CardSet myHand, CardSet board, Rng& rng) {
+    return simulateShowdown(myHand, board, rng) > 0; // ties count as a loss for simplicity
+}
+
+int playerAI::simulateShowdown(CardSet myHand, CardSet board, Rng& rng) {
+    CardSet fullBoard;
+    CardSet enemyHand;
+    dealShowdown(myHand, board, 1, rng, fullBoard, &enemyHand);
+    const uint16_t mine = Evaluator::evaluate(myHand | fullBoard);
+    const uint16_t theirs = Evaluator::evaluate(enemyHand | fullBoard);
+    return mine > theirs ? 1 : (mine == theirs ? 0 : -1);
+}
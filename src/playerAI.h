@@ -3,18 +3,166 @@
 
 #include "hand.h"
 #include "card.h"
+#include "cardSet.h"
 #include "comparer.h"
 #include "deck.h"
+#include "equity.h"
+#include "equityCache.h"
+#include "range.h"
+#include "rng.h"
+#include "threadPool.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
 
+// Handle to an equity query running in the background (playerAI::evaluateEquityAsync).
+// Poll ready() each frame; cancel() makes the workers stop at the next chunk.
+class EquityTask {
+public:
+    EquityTask() = default;
+
+    bool valid() const;     // False for a default-constructed handle
+    bool ready() const;     // Never blocks
+    EquityResult get();     // Blocks until done; only once per task
+    void cancel();
+    bool isCancelled() const;
+
+private:
+    friend class playerAI;
+    struct State {
+        std::atomic<bool> cancelled{false};
+        std::future<EquityResult> result;
+    };
+    std::shared_ptr<State> state_;
+};
+
+// Monte Carlo showdowns for one hand, kept between streets by playerAI::refineEquity.
+// Samples whose runout and opponent agree with newly revealed cards stay valid.
+// Not copyable; one refinement at a time (concurrent calls serialise).
+class EquitySamples {
+public:
+    EquitySamples() = default;
+    EquitySamples(const EquitySamples&) = delete;
+    EquitySamples& operator=(const EquitySamples&) = delete;
+
+    void clear();
+    size_t size() const;
+
+private:
+    friend class playerAI;
+    struct Sample {
+        CardSet board;     // Complete five-card board
+        CardSet opponents; // Hole cards of every opponent
+        int outcome;       // 0 loss, 1 win, k > 1 pot split k ways
+    };
+    mutable std::mutex mutex_;
+    CardSet hand_;
+    CardSet board_;
+    int opponents_ = 1;
+    std::vector<Sample> samples_;
+    uint64_t streamsUsed_ = 0; // Rng streams drawn from so far; new draws continue after them
+};
 
 class playerAI
 {
 public:
-    
-    
-    double evaluateHand(const Hand& hand, const std::vector<Card>& board);
+    playerAI(); // uses ThreadPool::shared()
+    explicit playerAI(ThreadPool& pool);
+    ~playerAI(); // Cancels and waits for outstanding async tasks
+
+    ThreadPool& getThreadPool() const;
+
+    // Master seed for evaluateHand. With a fixed seed the same inputs give
+    // bit-identical equity for any pool size; 0 (default) draws a fresh seed per call.
+    void setSeed(uint64_t seed);
+    uint64_t getSeed() const;
+    uint64_t getLastSeed() const; // Seed actually used by the latest evaluateHand, for bug reports
+
+    // Showdowns against options.opponents random hands (1..MAX_OPPONENTS; throws
+    // std::invalid_argument otherwise). Heads-up, enumerates every runout and
+    // opponent holding when there are at most getExactThreshold() of them
+    // (river and turn by default); otherwise runs Monte Carlo.
+    EquityResult evaluateEquity(const Hand& hand, const std::vector<Card>& board);
+    EquityResult evaluateEquity(const Hand& hand, const std::vector<Card>& board, const EquityOptions& options);
+    double evaluateHand(const Hand& hand, const std::vector<Card>& board, int opponents = 1); // Win probability only
+
+    // Heads-up equity of hero's holdings against villain's, each pair of
+    // non-overlapping holdings weighted by the product of their weights.
+    // Enumerates every runout when that costs at most getExactThreshold()
+    // showdown evaluations, otherwise draws holdings by weight (Monte Carlo).
+    // options.opponents and usePreflopTable are ignored; results are not cached.
+    EquityResult evaluateRangeEquity(const Hand& hand, const Range& villain, const std::vector<Card>& board);
+    EquityResult evaluateRangeEquity(const Hand& hand, const Range& villain, const std::vector<Card>& board,
+                                     const EquityOptions& options);
+    EquityResult evaluateRangeEquity(const Range& hero, const Range& villain, const std::vector<Card>& board);
+    EquityResult evaluateRangeEquity(const Range& hero, const Range& villain, const std::vector<Card>& board,
+                                     const EquityOptions& options);
+
+    // Same query on the thread pool; returns immediately. Cancelled tasks are not cached.
+    EquityTask evaluateEquityAsync(const Hand& hand, const std::vector<Card>& board);
+    EquityTask evaluateEquityAsync(const Hand& hand, const std::vector<Card>& board, const EquityOptions& options);
+
+    // Same query, reusing the Monte Carlo samples from the previous street of
+    // this hand: those consistent with the new board are kept and only enough
+    // fresh ones to meet options are added. samples must outlive an async task.
+    EquityResult refineEquity(EquitySamples& samples, const Hand& hand, const std::vector<Card>& board);
+    EquityResult refineEquity(EquitySamples& samples, const Hand& hand, const std::vector<Card>& board,
+                              const EquityOptions& options);
+    EquityTask refineEquityAsync(EquitySamples& samples, const Hand& hand, const std::vector<Card>& board);
+    EquityTask refineEquityAsync(EquitySamples& samples, const Hand& hand, const std::vector<Card>& board,
+                                 const EquityOptions& options);
+
+    // Options used by the overloads that do not take any
+    void setDefaultOptions(const EquityOptions& options);
+    const EquityOptions& getDefaultOptions() const;
+
+    // Results of exact and Monte Carlo queries are kept per suit-isomorphic
+    // (hand, board); repeats and isomorphic spots skip simulation
+    void setCacheBudget(size_t bytes); // 0 disables the cache
+    EquityCache::Stats getCacheStats() const;
+    void clearCache();
+
+    void setExactThreshold(uint64_t showdowns); // 0 disables exact enumeration
+    uint64_t getExactThreshold() const;
+    // Distinct heads-up (runout, opponent holding) pairs left for this hand and board
+    static uint64_t countShowdowns(CardSet hand, CardSet board);
+
+    bool simulateWin(const Hand& myHand, const std::vector<Card>& board);
+    bool simulateWin(CardSet myHand, CardSet board, Rng& rng);
+    // One random runout and heads-up opponent: 1 if myHand wins, 0 on a tie, -1 if it loses
+    int simulateShowdown(CardSet myHand, CardSet board, Rng& rng);
+
+private:
+    EquityTask submit(std::function<EquityResult(const std::atomic<bool>*)> query);
+    EquityResult computeEquity(CardSet hand, CardSet board, const EquityOptions& options,
+                               const std::atomic<bool>* cancel);
+    EquityResult computeRefinedEquity(EquitySamples& samples, CardSet hand, CardSet board,
+                                      const EquityOptions& options, const std::atomic<bool>* cancel);
+    // With samples, starts from the outcomes already in it and appends new
+    // draws, taken from Rng streams it has not used yet
+    EquityResult monteCarloEquity(CardSet hand, CardSet board, const EquityOptions& options,
+                                  const std::atomic<bool>* cancel, EquitySamples* samples = nullptr);
+    EquityResult exactEquity(CardSet hand, CardSet board, const std::atomic<bool>* cancel);
+    EquityResult rangeMonteCarloEquity(const Range& hero, const Range& villain, CardSet board,
+                                       const EquityOptions& options);
+    EquityResult rangeExactEquity(const Range& hero, const Range& villain, CardSet board);
+
+    ThreadPool* pool_;
+    uint64_t seed_ = 0;
+    uint64_t exactThreshold_;
+    EquityOptions defaultOptions_;
+    EquityCache cache_;
+    std::atomic<uint64_t> lastSeed_{0};
 
-    bool simulateWin(Hand myHand, std::vector<Card> board);
+    std::mutex tasksMutex_;
+    std::condition_variable tasksDone_;
+    std::vector<std::weak_ptr<EquityTask::State>> tasks_;
+    int runningTasks_ = 0;
 };
 
 #endif // PLAYERAI_H
\ No newline at end of file
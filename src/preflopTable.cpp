@@ -0,0 +1,65 @@
+#include "preflopTable.h"
+#include "preflopTableData.h"
+#include <algorithm>
+#include <cmath>
+
+int PreflopTable::classIndex(CardSet holeCards) {
+    if (holeCards.size() != 2) return -1;
+    uint64_t m = holeCards.mask();
+    const int first = CardSet::lowestIndex(m);
+    const int second = CardSet::lowestIndex(m & (m - 1));
+    const int rank1 = first % 13, rank2 = second % 13;
+    const int hi = std::max(rank1, rank2), lo = std::min(rank1, rank2);
+    if (hi == lo) return hi * 13 + hi;
+    const bool suited = first / 13 == second / 13;
+    return suited ? hi * 13 + lo : lo * 13 + hi;
+}
+
+std::string PreflopTable::className(int index) {
+    static const char* ranks = "23456789TJQKA";
+    const int row = index / 13, col = index % 13;
+    if (row == col) return std::string(2, ranks[row]);
+    const int hi = std::max(row, col), lo = std::min(row, col);
+    return std::string(1, ranks[hi]) + ranks[lo] + (row > col ? 's' : 'o');
+}
+
+CardSet PreflopTable::representative(int index) {
+    const int row = index / 13, col = index % 13;
+    CardSet hand;
+    hand.add(row);                              // first card in hearts
+    hand.add((row > col ? 0 : 13) + col);       // suited: hearts too, otherwise diamonds
+    return hand;
+}
+
+uint32_t PreflopTable::version() {
+    return PREFLOP_TABLE_VERSION;
+}
+
+int PreflopTable::maxOpponents() {
+    return PREFLOP_TABLE_OPPONENTS;
+}
+
+uint64_t PreflopTable::samplesPerClass(int opponents) {
+    if (opponents < 1 || opponents > PREFLOP_TABLE_OPPONENTS) return 0;
+    return PREFLOP_TABLE_SAMPLES[opponents - 1];
+}
+
+bool PreflopTable::lookup(CardSet holeCards, int opponents, EquityResult& result) {
+    const int index = classIndex(holeCards);
+    if (index < 0 || opponents < 1 || opponents > PREFLOP_TABLE_OPPONENTS) return false;
+
+    const uint16_t* entry = PREFLOP_TABLE[opponents - 1][index];
+    const uint64_t samples = PREFLOP_TABLE_SAMPLES[opponents - 1];
+    result = EquityResult();
+    result.win = entry[0] / 65535.0;
+    result.tie = entry[1] / 65535.0;
+    result.tieShare = entry[2] / 65535.0;
+    result.lose = std::max(0.0, 1.0 - result.win - result.tie);
+    result.samples = samples;
+    result.method = EquityResult::Method::PreflopTable;
+    // A k-way split pays 1/k, whose square is at most half of it, so this slightly overstates the error
+    const double mean = result.equity();
+    const double meanSquare = result.win + result.tieShare / 2.0;
+    result.stdError = std::sqrt(std::max(0.0, meanSquare - mean * mean) / samples);
+    return true;
+}
@@ -0,0 +1,31 @@
+#ifndef PREFLOPTABLE_H
+#define PREFLOPTABLE_H
+
+#include <cstdint>
+#include <string>
+#include "cardSet.h"
+#include "equity.h"
+
+// Precomputed empty-board equity for the 169 suit-isomorphic starting hands
+// against 1..maxOpponents() random hands.
+// The data lives in preflopTableData.h, generated offline by poker_preflop_gen.
+//
+// Class index on the 13x13 grid (rank 0 = Two .. 12 = Ace): a pair sits on the
+// diagonal at r * 13 + r, suited hands at hi * 13 + lo and offsuit at lo * 13 + hi.
+class PreflopTable {
+public:
+    static constexpr int NUM_CLASSES = 169;
+
+    static int classIndex(CardSet holeCards); // -1 unless exactly two cards
+    static std::string className(int index);  // "AA", "AKs", "72o"
+    static CardSet representative(int index); // One concrete holding of the class
+
+    static uint32_t version();
+    static int maxOpponents();
+    static uint64_t samplesPerClass(int opponents = 1);
+
+    // Fills result and returns true if the table covers this holding and opponent count
+    static bool lookup(CardSet holeCards, int opponents, EquityResult& result);
+};
+
+#endif // PREFLOPTABLE_H
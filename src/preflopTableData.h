@@ -0,0 +1,1551 @@
+// Generated by poker_preflop_gen (tools/preflopTableGen.cpp). Do not edit by hand.
+// 4000000 heads-up / 250000 multi-way samples per class, seed 1.
+#pragma once
+#include <cstdint>
+
+constexpr uint32_t PREFLOP_TABLE_VERSION = 2;
+constexpr int PREFLOP_TABLE_OPPONENTS = 9;
+constexpr uint64_t PREFLOP_TABLE_SAMPLES[PREFLOP_TABLE_OPPONENTS] = {4000000, 250000, 250000, 250000, 250000, 250000, 250000, 250000, 250000};
+
+// {win, tie, tieShare} in units of 1/65535, indexed [opponents - 1][PreflopTable::classIndex]
+constexpr uint16_t PREFLOP_TABLE[PREFLOP_TABLE_OPPONENTS][169][3] = {
+    { // 1 opponent
+        {32347, 1243, 622}, // 22
+        {19163, 4017, 2008}, // 32o
+        {19749, 4031, 2015}, // 42o
+        {20427, 4049, 2024}, // 52o
+        {20376, 3918, 1959}, // 62o
+        {20776, 3761, 1880}, // 72o
+        {22330, 3595, 1798}, // 82o
+        {23926, 3392, 1696}, // 92o
+        {25702, 3185, 1592}, // T2o
+        {27565, 3003, 1501}, // J2o
+        {29534, 2871, 1435}, // Q2o
+        {31702, 2735, 1367}, // K2o
+        {34722, 2589, 1295}, // A2o
+        {21708, 3800, 1900}, // 32s
+        {34650, 1118, 559}, // 33
+        {21011, 4038, 2019}, // 43o
+        {21753, 4057, 2029}, // 53o
+        {21675, 3928, 1964}, // 63o
+        {22119, 3763, 1881}, // 73o
+        {22801, 3578, 1789}, // 83o
+        {24526, 3397, 1699}, // 93o
+        {26319, 3199, 1599}, // T3o
+        {28162, 3029, 1514}, // J3o
+        {30162, 2883, 1441}, // Q3o
+        {32354, 2741, 1371}, // K3o
+        {35302, 2604, 1302}, // A3o
+        {22231, 3805, 1902}, // 42s
+        {23406, 3832, 1916}, // 43s
+        {36857, 1002, 501}, // 44
+        {22967, 4034, 2017}, // 54o
+        {22938, 3949, 1974}, // 64o
+        {23369, 3800, 1900}, // 74o
+        {24036, 3592, 1796}, // 84o
+        {24951, 3385, 1693}, // 94o
+        {26889, 3217, 1608}, // T4o
+        {28758, 3041, 1520}, // J4o
+        {30793, 2884, 1442}, // Q4o
+        {32921, 2753, 1376}, // K4o
+        {35891, 2618, 1309}, // A4o
+        {22855, 3826, 1913}, // 52s
+        {24066, 3849, 1924}, // 53s
+        {25254, 3814, 1907}, // 54s
+        {39061, 902, 451}, // 55
+        {24243, 3852, 1926}, // 65o
+        {24688, 3722, 1861}, // 75o
+        {25371, 3533, 1766}, // 85o
+        {26292, 3328, 1664}, // 95o
+        {27425, 3130, 1565}, // T5o
+        {29429, 2981, 1490}, // J5o
+        {31449, 2835, 1417}, // Q5o
+        {33567, 2692, 1346}, // K5o
+        {36549, 2562, 1281}, // A5o
+        {22827, 3707, 1854}, // 62s
+        {24027, 3724, 1862}, // 63s
+        {25201, 3727, 1863}, // 64s
+        {26424, 3646, 1823}, // 65s
+        {41098, 767, 383}, // 66
+        {25977, 3498, 1749}, // 76o
+        {26681, 3337, 1668}, // 86o
+        {27605, 3114, 1557}, // 96o
+        {28727, 2940, 1470}, // T6o
+        {29946, 2792, 1396}, // J6o
+        {32113, 2654, 1327}, // Q6o
+        {34278, 2517, 1258}, // K6o
+        {36604, 2374, 1187}, // A6o
+        {23240, 3557, 1778}, // 72s
+        {24445, 3577, 1789}, // 73s
+        {25645, 3586, 1793}, // 74s
+        {26844, 3538, 1769}, // 75s
+        {28047, 3334, 1667}, // 76s
+        {43063, 676, 338}, // 77
+        {28000, 3092, 1546}, // 87o
+        {28899, 2914, 1457}, // 97o
+        {30012, 2730, 1365}, // T7o
+        {31270, 2562, 1281}, // J7o
+        {32703, 2439, 1220}, // Q7o
+        {35028, 2326, 1163}, // K7o
+        {37477, 2183, 1091}, // A7o
+        {24684, 3400, 1700}, // 82s
+        {25089, 3406, 1703}, // 83s
+        {26273, 3399, 1699}, // 84s
+        {27490, 3363, 1682}, // 85s
+        {28708, 3171, 1585}, // 86s
+        {29925, 2954, 1477}, // 87s
+        {45029, 587, 293}, // 88
+        {30192, 2655, 1327}, // 98o
+        {31308, 2507, 1254}, // T8o
+        {32601, 2321, 1161}, // J8o
+        {34047, 2196, 1098}, // Q8o
+        {35661, 2077, 1038}, // K8o
+        {38273, 1964, 982}, // A8o
+        {26191, 3201, 1600}, // 92s
+        {26737, 3212, 1606}, // 93s
+        {27159, 3220, 1610}, // 94s
+        {28395, 3160, 1580}, // 95s
+        {29613, 2993, 1497}, // 96s
+        {30769, 2779, 1390}, // 97s
+        {32000, 2548, 1274}, // 98s
+        {46962, 516, 258}, // 99
+        {32654, 2255, 1127}, // T9o
+        {33825, 2115, 1058}, // J9o
+        {35315, 1961, 980}, // Q9o
+        {36982, 1842, 921}, // K9o
+        {38960, 1735, 868}, // A9o
+        {27887, 3015, 1508}, // T2s
+        {28413, 3036, 1518}, // T3s
+        {28999, 3045, 1522}, // T4s
+        {29430, 2992, 1496}, // T5s
+        {30665, 2812, 1406}, // T6s
+        {31867, 2605, 1302}, // T7s
+        {33110, 2389, 1194}, // T8s
+        {34309, 2154, 1077}, // T9s
+        {48936, 456, 228}, // TT
+        {35249, 1860, 930}, // JTo
+        {36667, 1753, 877}, // QTo
+        {38350, 1635, 818}, // KTo
+        {40344, 1508, 754}, // ATo
+        {29644, 2846, 1423}, // J2s
+        {30185, 2868, 1434}, // J3s
+        {30760, 2882, 1441}, // J4s
+        {31342, 2831, 1416}, // J5s
+        {31825, 2660, 1330}, // J6s
+        {33063, 2459, 1229}, // J7s
+        {34306, 2233, 1116}, // J8s
+        {35458, 2045, 1023}, // J9s
+        {36786, 1792, 896}, // JTs
+        {50552, 416, 208}, // JJ
+        {37293, 1607, 803}, // QJo
+        {38978, 1482, 741}, // KJo
+        {40999, 1349, 674}, // AJo
+        {31517, 2721, 1360}, // Q2s
+        {32051, 2715, 1358}, // Q3s
+        {32636, 2736, 1368}, // Q4s
+        {33258, 2682, 1341}, // Q5s
+        {33858, 2537, 1268}, // Q6s
+        {34430, 2335, 1167}, // Q7s
+        {35662, 2094, 1047}, // Q8s
+        {36844, 1891, 946}, // Q9s
+        {38140, 1702, 851}, // QTs
+        {38683, 1556, 778}, // QJs
+        {52180, 383, 191}, // QQ
+        {39606, 1346, 673}, // KQo
+        {41618, 1215, 607}, // AQo
+        {33602, 2586, 1293}, // K2s
+        {34100, 2602, 1301}, // K3s
+        {34645, 2625, 1312}, // K4s
+        {35300, 2565, 1282}, // K5s
+        {35917, 2404, 1202}, // K6s
+        {36592, 2220, 1110}, // K7s
+        {37230, 1989, 995}, // K8s
+        {38432, 1763, 882}, // K9s
+        {39689, 1573, 787}, // KTs
+        {40299, 1423, 712}, // KJs
+        {40883, 1307, 654}, // KQs
+        {53816, 362, 181}, // KK
+        {42225, 1114, 557}, // AKo
+        {36415, 2451, 1225}, // A2s
+        {36926, 2475, 1238}, // A3s
+        {37467, 2492, 1246}, // A4s
+        {38037, 2453, 1226}, // A5s
+        {38127, 2247, 1124}, // A6s
+        {38910, 2104, 1052}, // A7s
+        {39661, 1880, 940}, // A8s
+        {40312, 1665, 832}, // A9s
+        {41583, 1462, 731}, // ATs
+        {42184, 1306, 653}, // AJs
+        {42812, 1171, 586}, // AQs
+        {43411, 1081, 540}, // AKs
+        {55644, 351, 176}  // AA
+    },
+    { // 2 opponents
+        {19817, 755, 269}, // 22
+        {12106, 2117, 906}, // 32o
+        {12573, 2189, 945}, // 42o
+        {13020, 2233, 969}, // 52o
+        {12660, 2203, 957}, // 62o
+        {12508, 2226, 978}, // 72o
+        {13234, 2356, 1043}, // 82o
+        {14013, 2411, 1085}, // 92o
+        {15097, 2482, 1130}, // T2o
+        {16160, 2487, 1147}, // J2o
+        {17518, 2569, 1196}, // Q2o
+        {19092, 2665, 1257}, // K2o
+        {21951, 2715, 1294}, // A2o
+        {14794, 2061, 883}, // 32s
+        {21684, 721, 265}, // 33
+        {13790, 2284, 988}, // 43o
+        {14458, 2357, 1026}, // 53o
+        {13956, 2269, 990}, // 63o
+        {13718, 2352, 1037}, // 73o
+        {13628, 2358, 1049}, // 83o
+        {14622, 2384, 1077}, // 93o
+        {15478, 2527, 1154}, // T3o
+        {16776, 2529, 1166}, // J3o
+        {18130, 2625, 1226}, // Q3o
+        {19721, 2703, 1275}, // K3o
+        {22425, 2824, 1350}, // A3o
+        {15175, 2099, 907}, // 42s
+        {16470, 2137, 928}, // 43s
+        {23672, 699, 264}, // 44
+        {15578, 2361, 1035}, // 54o
+        {15136, 2362, 1039}, // 64o
+        {15052, 2384, 1056}, // 74o
+        {14913, 2444, 1092}, // 84o
+        {14879, 2494, 1129}, // 94o
+        {16268, 2534, 1162}, // T4o
+        {17227, 2649, 1228}, // J4o
+        {18703, 2673, 1252}, // Q4o
+        {20202, 2710, 1283}, // K4o
+        {23037, 2837, 1357}, // A4o
+        {15660, 2153, 938}, // 52s
+        {16866, 2220, 971}, // 53s
+        {18119, 2275, 997}, // 54s
+        {26002, 700, 272}, // 55
+        {16439, 2363, 1043}, // 65o
+        {16330, 2461, 1092}, // 75o
+        {16193, 2425, 1081}, // 85o
+        {16175, 2506, 1134}, // 95o
+        {16491, 2613, 1197}, // T5o
+        {17836, 2649, 1227}, // J5o
+        {19251, 2702, 1266}, // Q5o
+        {20857, 2768, 1307}, // K5o
+        {23506, 2811, 1346}, // A5o
+        {15317, 2142, 933}, // 62s
+        {16520, 2200, 962}, // 63s
+        {17606, 2251, 988}, // 64s
+        {18820, 2273, 1000}, // 65s
+        {28097, 614, 246}, // 66
+        {17564, 2361, 1047}, // 76o
+        {17506, 2396, 1071}, // 86o
+        {17680, 2405, 1092}, // 96o
+        {18073, 2422, 1112}, // T6o
+        {18385, 2490, 1149}, // J6o
+        {19961, 2572, 1208}, // Q6o
+        {21668, 2640, 1252}, // K6o
+        {23543, 2653, 1272}, // A6o
+        {15179, 2182, 959}, // 72s
+        {16291, 2230, 981}, // 73s
+        {17515, 2281, 1007}, // 74s
+        {18705, 2369, 1052}, // 75s
+        {19858, 2280, 1015}, // 76s
+        {30092, 615, 247}, // 77
+        {18927, 2272, 1016}, // 87o
+        {18901, 2355, 1062}, // 97o
+        {19281, 2363, 1079}, // T7o
+        {19865, 2327, 1072}, // J7o
+        {20532, 2417, 1128}, // Q7o
+        {22509, 2440, 1153}, // K7o
+        {24553, 2523, 1209}, // A7o
+        {15828, 2272, 1009}, // 82s
+        {16306, 2240, 998}, // 83s
+        {17275, 2340, 1043}, // 84s
+        {18774, 2315, 1035}, // 85s
+        {19926, 2286, 1020}, // 86s
+        {21165, 2253, 1005}, // 87s
+        {32433, 567, 232}, // 88
+        {20480, 2168, 973}, // 98o
+        {20871, 2186, 995}, // T8o
+        {21404, 2193, 1007}, // J8o
+        {22202, 2175, 1013}, // Q8o
+        {23155, 2225, 1047}, // K8o
+        {25538, 2318, 1107}, // A8o
+        {16649, 2279, 1023}, // 92s
+        {17127, 2315, 1042}, // 93s
+        {17558, 2399, 1082}, // 94s
+        {18813, 2353, 1063}, // 95s
+        {20032, 2297, 1038}, // 96s
+        {21367, 2214, 998}, // 97s
+        {22720, 2078, 933}, // 98s
+        {34898, 542, 226}, // 99
+        {22476, 2038, 923}, // T9o
+        {22911, 2052, 940}, // J9o
+        {23662, 2033, 940}, // Q9o
+        {24685, 2080, 976}, // K9o
+        {26244, 2068, 984}, // A9o
+        {17685, 2391, 1088}, // T2s
+        {18143, 2402, 1096}, // T3s
+        {18606, 2452, 1121}, // T4s
+        {19081, 2439, 1115}, // T5s
+        {20328, 2361, 1080}, // T6s
+        {21640, 2270, 1034}, // T7s
+        {23064, 2133, 968}, // T8s
+        {24422, 1962, 893}, // T9s
+        {37424, 498, 212}, // TT
+        {24723, 1867, 854}, // JTo
+        {25461, 1855, 857}, // QTo
+        {26659, 1825, 847}, // KTo
+        {28157, 1875, 887}, // ATo
+        {18821, 2380, 1094}, // J2s
+        {19346, 2414, 1112}, // J3s
+        {19729, 2498, 1154}, // J4s
+        {20228, 2537, 1173}, // J5s
+        {20724, 2359, 1092}, // J6s
+        {22016, 2284, 1048}, // J7s
+        {23575, 2108, 969}, // J8s
+        {25012, 1998, 910}, // J9s
+        {26687, 1805, 823}, // JTs
+        {39946, 445, 187}, // JJ
+        {26306, 1677, 766}, // QJo
+        {27525, 1676, 775}, // KJo
+        {29021, 1660, 783}, // AJo
+        {20155, 2460, 1144}, // Q2s
+        {20614, 2488, 1161}, // Q3s
+        {21059, 2521, 1180}, // Q4s
+        {21582, 2479, 1158}, // Q5s
+        {22278, 2454, 1144}, // Q6s
+        {22776, 2295, 1071}, // Q7s
+        {24282, 2072, 959}, // Q8s
+        {25710, 1986, 917}, // Q9s
+        {27370, 1831, 840}, // QTs
+        {28195, 1650, 752}, // QJs
+        {42358, 410, 171}, // QQ
+        {28452, 1499, 688}, // KQo
+        {29925, 1469, 689}, // AQo
+        {21698, 2514, 1181}, // K2s
+        {22248, 2550, 1203}, // K3s
+        {22707, 2576, 1212}, // K4s
+        {23285, 2657, 1253}, // K5s
+        {23898, 2461, 1162}, // K6s
+        {24711, 2402, 1129}, // K7s
+        {25396, 2167, 1016}, // K8s
+        {26855, 1934, 901}, // K9s
+        {28688, 1783, 828}, // KTs
+        {29349, 1553, 716}, // KJs
+        {30224, 1436, 656}, // KQs
+        {44973, 401, 162}, // KK
+        {31055, 1313, 608}, // AKo
+        {24105, 2638, 1257}, // A2s
+        {24685, 2652, 1265}, // A3s
+        {25286, 2715, 1300}, // A4s
+        {25853, 2707, 1291}, // A5s
+        {25677, 2567, 1226}, // A6s
+        {26697, 2413, 1153}, // A7s
+        {27509, 2192, 1042}, // A8s
+        {28318, 2028, 961}, // A9s
+        {30049, 1760, 829}, // ATs
+        {30810, 1603, 753}, // AJs
+        {31762, 1405, 654}, // AQs
+        {32689, 1265, 582}, // AKs
+        {48004, 395, 160}  // AA
+    },
+    { // 3 opponents
+        {14234, 554, 168}, // 22
+        {8461, 1630, 687}, // 32o
+        {8978, 1731, 738}, // 42o
+        {9412, 1752, 750}, // 52o
+        {8875, 1758, 758}, // 62o
+        {8526, 1851, 805}, // 72o
+        {9162, 1905, 836}, // 82o
+        {9702, 1951, 862}, // 92o
+        {10460, 2061, 917}, // T2o
+        {11285, 2147, 964}, // J2o
+        {12246, 2201, 1001}, // Q2o
+        {13334, 2360, 1085}, // K2o
+        {15415, 2612, 1221}, // A2o
+        {11251, 1550, 650}, // 32s
+        {15604, 554, 183}, // 33
+        {9903, 1777, 765}, // 43o
+        {10503, 1897, 824}, // 53o
+        {10014, 1833, 796}, // 63o
+        {9548, 1887, 822}, // 73o
+        {9407, 1937, 856}, // 83o
+        {10054, 2031, 898}, // 93o
+        {10863, 2138, 953}, // T3o
+        {11572, 2217, 1000}, // J3o
+        {12606, 2298, 1050}, // Q3o
+        {13830, 2426, 1119}, // K3o
+        {15924, 2623, 1227}, // A3o
+        {11658, 1641, 702}, // 42s
+        {12585, 1755, 757}, // 43s
+        {17035, 571, 200}, // 44
+        {11451, 2020, 884}, // 54o
+        {11142, 1933, 847}, // 64o
+        {10766, 1960, 860}, // 74o
+        {10665, 2014, 889}, // 84o
+        {10430, 2086, 929}, // 94o
+        {11329, 2275, 1024}, // T4o
+        {12093, 2304, 1040}, // J4o
+        {12976, 2387, 1090}, // Q4o
+        {14336, 2528, 1170}, // K4o
+        {16615, 2723, 1276}, // A4o
+        {12023, 1732, 752}, // 52s
+        {13058, 1774, 771}, // 53s
+        {14033, 1922, 844}, // 54s
+        {18663, 583, 215}, // 55
+        {12222, 2071, 914}, // 65o
+        {11964, 2055, 912}, // 75o
+        {11782, 2157, 958}, // 85o
+        {11563, 2144, 955}, // 95o
+        {11622, 2289, 1031}, // T5o
+        {12502, 2349, 1068}, // J5o
+        {13522, 2438, 1118}, // Q5o
+        {14751, 2521, 1170}, // K5o
+        {17055, 2743, 1290}, // A5o
+        {11530, 1677, 724}, // 62s
+        {12625, 1791, 777}, // 63s
+        {13790, 1866, 815}, // 64s
+        {14550, 1928, 845}, // 65s
+        {20464, 564, 214}, // 66
+        {13127, 2019, 895}, // 76o
+        {12987, 2050, 913}, // 86o
+        {13005, 2103, 936}, // 96o
+        {12946, 2194, 991}, // T6o
+        {13008, 2237, 1015}, // J6o
+        {14135, 2376, 1090}, // Q6o
+        {15382, 2441, 1135}, // K6o
+        {16660, 2631, 1237}, // A6o
+        {11374, 1703, 735}, // 72s
+        {12437, 1839, 804}, // 73s
+        {13379, 1882, 823}, // 74s
+        {14477, 1996, 879}, // 75s
+        {15426, 1945, 862}, // 76s
+        {22377, 538, 209}, // 77
+        {14265, 2009, 891}, // 87o
+        {14168, 2059, 918}, // 97o
+        {14341, 2122, 957}, // T7o
+        {14374, 2133, 965}, // J7o
+        {14614, 2222, 1020}, // Q7o
+        {16079, 2377, 1101}, // K7o
+        {17570, 2502, 1179}, // A7o
+        {11893, 1829, 800}, // 82s
+        {12133, 1887, 826}, // 83s
+        {13255, 1940, 858}, // 84s
+        {14301, 1971, 873}, // 85s
+        {15466, 1965, 874}, // 86s
+        {16602, 1958, 866}, // 87s
+        {24473, 534, 211}, // 88
+        {15341, 1978, 882}, // 98o
+        {15692, 2033, 919}, // T8o
+        {15747, 2089, 943}, // J8o
+        {16150, 2068, 943}, // Q8o
+        {16848, 2150, 995}, // K8o
+        {18489, 2364, 1108}, // A8o
+        {12439, 1853, 812}, // 92s
+        {12763, 1960, 868}, // 93s
+        {13148, 1980, 882}, // 94s
+        {14103, 2064, 915}, // 95s
+        {15453, 1984, 885}, // 96s
+        {16613, 1955, 871}, // 97s
+        {17873, 1875, 836}, // 98s
+        {26745, 517, 209}, // 99
+        {17303, 1952, 877}, // T9o
+        {17275, 1967, 885}, // J9o
+        {17731, 1910, 866}, // Q9o
+        {18476, 1951, 892}, // K9o
+        {19316, 2155, 1002}, // A9o
+        {13327, 1984, 881}, // T2s
+        {13580, 2055, 918}, // T3s
+        {13898, 2157, 972}, // T4s
+        {14216, 2129, 953}, // T5s
+        {15418, 2125, 954}, // T6s
+        {16683, 2036, 913}, // T7s
+        {18046, 1967, 879}, // T8s
+        {19404, 1898, 849}, // T9s
+        {29394, 546, 227}, // TT
+        {19384, 1848, 834}, // JTo
+        {19705, 1799, 814}, // QTo
+        {20364, 1874, 856}, // KTo
+        {21373, 1943, 906}, // ATo
+        {13942, 2026, 906}, // J2s
+        {14367, 2052, 925}, // J3s
+        {14814, 2216, 1001}, // J4s
+        {15102, 2209, 1000}, // J5s
+        {15586, 2158, 980}, // J6s
+        {16919, 2071, 934}, // J7s
+        {18252, 1957, 879}, // J8s
+        {19678, 1891, 847}, // J9s
+        {21424, 1777, 798}, // JTs
+        {31977, 497, 204}, // JJ
+        {20603, 1663, 748}, // QJo
+        {21297, 1694, 770}, // KJo
+        {22422, 1726, 799}, // AJo
+        {14848, 2115, 959}, // Q2s
+        {15397, 2180, 992}, // Q3s
+        {15632, 2311, 1053}, // Q4s
+        {16208, 2294, 1048}, // Q5s
+        {16651, 2224, 1018}, // Q6s
+        {17214, 2135, 971}, // Q7s
+        {18572, 1959, 887}, // Q8s
+        {20033, 1851, 834}, // Q9s
+        {21891, 1839, 829}, // QTs
+        {22607, 1612, 721}, // QJs
+        {34948, 434, 173}, // QQ
+        {22396, 1501, 674}, // KQo
+        {23426, 1564, 715}, // AQo
+        {16080, 2279, 1047}, // K2s
+        {16427, 2360, 1089}, // K3s
+        {16964, 2395, 1107}, // K4s
+        {17339, 2464, 1138}, // K5s
+        {17987, 2355, 1091}, // K6s
+        {18510, 2275, 1052}, // K7s
+        {19129, 2092, 956}, // K8s
+        {20659, 1910, 874}, // K9s
+        {22566, 1740, 795}, // KTs
+        {23495, 1593, 719}, // KJs
+        {24319, 1430, 640}, // KQs
+        {37941, 407, 160}, // KK
+        {24739, 1352, 614}, // AKo
+        {18116, 2439, 1141}, // A2s
+        {18522, 2546, 1195}, // A3s
+        {19102, 2585, 1212}, // A4s
+        {19527, 2662, 1249}, // A5s
+        {19271, 2510, 1175}, // A6s
+        {20107, 2423, 1134}, // A7s
+        {20971, 2232, 1045}, // A8s
+        {21709, 2075, 962}, // A9s
+        {23466, 1877, 871}, // ATs
+        {24379, 1676, 772}, // AJs
+        {25510, 1494, 684}, // AQs
+        {26599, 1321, 599}, // AKs
+        {41654, 372, 146}  // AA
+    },
+    { // 4 opponents
+        {11564, 419, 115}, // 22
+        {6529, 1291, 541}, // 32o
+        {6906, 1436, 611}, // 42o
+        {7189, 1567, 675}, // 52o
+        {6658, 1595, 693}, // 62o
+        {6300, 1634, 712}, // 72o
+        {6741, 1677, 736}, // 82o
+        {7241, 1759, 774}, // 92o
+        {7859, 1911, 849}, // T2o
+        {8452, 1936, 861}, // J2o
+        {9172, 2021, 909}, // Q2o
+        {10207, 2142, 972}, // K2o
+        {11906, 2444, 1130}, // A2o
+        {9311, 1274, 537}, // 32s
+        {12353, 487, 156}, // 33
+        {7761, 1548, 670}, // 43o
+        {8241, 1650, 718}, // 53o
+        {7727, 1608, 704}, // 63o
+        {7245, 1672, 736}, // 73o
+        {7026, 1760, 775}, // 83o
+        {7500, 1822, 808}, // 93o
+        {8210, 1953, 876}, // T3o
+        {8744, 1993, 892}, // J3o
+        {9561, 2076, 933}, // Q3o
+        {10488, 2275, 1039}, // K3o
+        {12296, 2510, 1163}, // A3o
+        {9639, 1385, 591}, // 42s
+        {10473, 1546, 669}, // 43s
+        {13297, 517, 181}, // 44
+        {9073, 1778, 784}, // 54o
+        {8656, 1719, 760}, // 64o
+        {8218, 1771, 786}, // 74o
+        {7954, 1824, 809}, // 84o
+        {7808, 1919, 851}, // 94o
+        {8503, 2101, 943}, // T4o
+        {9079, 2091, 940}, // J4o
+        {9832, 2194, 994}, // Q4o
+        {10809, 2316, 1062}, // K4o
+        {12829, 2641, 1230}, // A4o
+        {9970, 1517, 657}, // 52s
+        {10789, 1628, 710}, // 53s
+        {11667, 1691, 746}, // 54s
+        {14428, 599, 226}, // 55
+        {9631, 1827, 810}, // 65o
+        {9363, 1896, 843}, // 75o
+        {9030, 1935, 867}, // 85o
+        {8758, 1963, 881}, // 95o
+        {8801, 2105, 948}, // T5o
+        {9391, 2185, 987}, // J5o
+        {10273, 2301, 1047}, // Q5o
+        {11254, 2426, 1117}, // K5o
+        {13169, 2664, 1236}, // A5o
+        {9461, 1469, 634}, // 62s
+        {10396, 1516, 664}, // 63s
+        {11284, 1698, 748}, // 64s
+        {12142, 1750, 776}, // 65s
+        {15754, 559, 215}, // 66
+        {10313, 1863, 830}, // 76o
+        {10151, 1938, 866}, // 86o
+        {9953, 1908, 852}, // 96o
+        {9805, 2031, 915}, // T6o
+        {9898, 2127, 961}, // J6o
+        {10658, 2227, 1016}, // Q6o
+        {11791, 2325, 1071}, // K6o
+        {12943, 2521, 1176}, // A6o
+        {9212, 1508, 654}, // 72s
+        {10063, 1610, 705}, // 73s
+        {10898, 1708, 751}, // 74s
+        {11896, 1841, 816}, // 75s
+        {12792, 1801, 803}, // 76s
+        {17295, 537, 209}, // 77
+        {11277, 1918, 856}, // 87o
+        {11100, 1870, 838}, // 97o
+        {11141, 2024, 914}, // T7o
+        {11111, 2022, 918}, // J7o
+        {11299, 2059, 935}, // Q7o
+        {12415, 2154, 985}, // K7o
+        {13557, 2439, 1138}, // A7o
+        {9570, 1623, 715}, // 82s
+        {9815, 1679, 739}, // 83s
+        {10642, 1774, 783}, // 84s
+        {11676, 1833, 815}, // 85s
+        {12650, 1812, 808}, // 86s
+        {13667, 1795, 805}, // 87s
+        {19063, 538, 214}, // 88
+        {12330, 1872, 840}, // 98o
+        {12470, 1990, 896}, // T8o
+        {12443, 1993, 900}, // J8o
+        {12623, 1967, 890}, // Q8o
+        {12999, 2053, 941}, // K8o
+        {14320, 2315, 1070}, // A8o
+        {9991, 1644, 725}, // 92s
+        {10367, 1756, 777}, // 93s
+        {10465, 1841, 818}, // 94s
+        {11457, 1869, 830}, // 95s
+        {12483, 1868, 835}, // 96s
+        {13636, 1805, 805}, // 97s
+        {14716, 1797, 802}, // 98s
+        {21077, 538, 219}, // 99
+        {13874, 1866, 843}, // T9o
+        {13930, 1856, 836}, // J9o
+        {14030, 1873, 844}, // Q9o
+        {14557, 1922, 873}, // K9o
+        {15154, 2109, 972}, // A9o
+        {10632, 1764, 782}, // T2s
+        {10919, 1881, 840}, // T3s
+        {11171, 2026, 912}, // T4s
+        {11411, 2053, 923}, // T5s
+        {12559, 1962, 881}, // T6s
+        {13611, 1929, 869}, // T7s
+        {14895, 1896, 845}, // T8s
+        {16142, 1857, 834}, // T9s
+        {23627, 577, 242}, // TT
+        {15718, 1868, 842}, // JTo
+        {15947, 1811, 822}, // QTo
+        {16455, 1855, 841}, // KTo
+        {17129, 1989, 918}, // ATo
+        {11238, 1818, 813}, // J2s
+        {11534, 1928, 868}, // J3s
+        {11818, 2015, 909}, // J4s
+        {12193, 2085, 940}, // J5s
+        {12509, 1963, 890}, // J6s
+        {13653, 1943, 872}, // J7s
+        {14848, 1874, 847}, // J8s
+        {16213, 1785, 792}, // J9s
+        {18002, 1770, 799}, // JTs
+        {26186, 518, 215}, // JJ
+        {16896, 1634, 735}, // QJo
+        {17365, 1692, 760}, // KJo
+        {18104, 1790, 823}, // AJo
+        {12014, 1924, 863}, // Q2s
+        {12383, 2020, 911}, // Q3s
+        {12553, 2094, 951}, // Q4s
+        {12976, 2179, 987}, // Q5s
+        {13541, 2088, 951}, // Q6s
+        {13742, 2004, 909}, // Q7s
+        {15114, 1894, 858}, // Q8s
+        {16456, 1793, 809}, // Q9s
+        {18197, 1736, 780}, // QTs
+        {19090, 1629, 729}, // QJs
+        {28964, 454, 187}, // QQ
+        {18515, 1467, 652}, // KQo
+        {19299, 1561, 713}, // AQo
+        {12982, 1999, 910}, // K2s
+        {13444, 2090, 955}, // K3s
+        {13634, 2214, 1014}, // K4s
+        {14005, 2289, 1047}, // K5s
+        {14427, 2213, 1014}, // K6s
+        {15038, 2109, 965}, // K7s
+        {15517, 2018, 916}, // K8s
+        {17017, 1868, 846}, // K9s
+        {18728, 1749, 792}, // KTs
+        {19691, 1635, 738}, // KJs
+        {20666, 1429, 640}, // KQs
+        {32573, 407, 158}, // KK
+        {20483, 1369, 615}, // AKo
+        {14812, 2277, 1051}, // A2s
+        {15131, 2439, 1131}, // A3s
+        {15454, 2470, 1147}, // A4s
+        {15789, 2571, 1196}, // A5s
+        {15583, 2388, 1110}, // A6s
+        {16185, 2346, 1087}, // A7s
+        {16755, 2190, 1012}, // A8s
+        {17709, 1990, 917}, // A9s
+        {19532, 1900, 871}, // ATs
+        {20389, 1703, 778}, // AJs
+        {21384, 1509, 684}, // AQs
+        {22590, 1299, 584}, // AKs
+        {36466, 370, 146}  // AA
+    },
+    { // 5 opponents
+        {10025, 350, 94}, // 22
+        {5391, 1141, 477}, // 32o
+        {5739, 1297, 554}, // 42o
+        {5929, 1402, 608}, // 52o
+        {5343, 1379, 601}, // 62o
+        {5006, 1475, 644}, // 72o
+        {5356, 1558, 681}, // 82o
+        {5685, 1576, 692}, // 92o
+        {6122, 1813, 803}, // T2o
+        {6646, 1778, 798}, // J2o
+        {7337, 1851, 828}, // Q2o
+        {8181, 1939, 877}, // K2o
+        {9684, 2298, 1061}, // A2o
+        {8110, 1118, 469}, // 32s
+        {10529, 424, 136}, // 33
+        {6442, 1391, 604}, // 43o
+        {6830, 1565, 689}, // 53o
+        {6273, 1467, 641}, // 63o
+        {5819, 1530, 671}, // 73o
+        {5529, 1639, 719}, // 83o
+        {5891, 1710, 755}, // 93o
+        {6361, 1865, 836}, // T3o
+        {6918, 1878, 846}, // J3o
+        {7621, 1942, 877}, // Q3o
+        {8450, 2046, 932}, // K3o
+        {9958, 2376, 1091}, // A3o
+        {8375, 1219, 522}, // 42s
+        {9066, 1353, 581}, // 43s
+        {11071, 486, 176}, // 44
+        {7616, 1670, 738}, // 54o
+        {7086, 1624, 715}, // 64o
+        {6728, 1659, 731}, // 74o
+        {6298, 1699, 753}, // 84o
+        {6048, 1806, 807}, // 94o
+        {6619, 1969, 884}, // T4o
+        {7155, 1983, 892}, // J4o
+        {7830, 2089, 943}, // Q4o
+        {8597, 2211, 1004}, // K4o
+        {10395, 2440, 1126}, // A4o
+        {8553, 1373, 597}, // 52s
+        {9435, 1461, 643}, // 53s
+        {10077, 1600, 709}, // 54s
+        {12024, 569, 219}, // 55
+        {7917, 1710, 760}, // 65o
+        {7717, 1737, 780}, // 75o
+        {7254, 1801, 802}, // 85o
+        {6980, 1891, 849}, // 95o
+        {6848, 2080, 934}, // T5o
+        {7430, 2103, 953}, // J5o
+        {8023, 2169, 981}, // Q5o
+        {8946, 2276, 1039}, // K5o
+        {10683, 2564, 1187}, // A5o
+        {8063, 1323, 574}, // 62s
+        {8855, 1432, 629}, // 63s
+        {9650, 1505, 665}, // 64s
+        {10433, 1645, 731}, // 65s
+        {12997, 529, 209}, // 66
+        {8577, 1740, 777}, // 76o
+        {8301, 1763, 789}, // 86o
+        {7989, 1840, 829}, // 96o
+        {7852, 2032, 915}, // T6o
+        {7771, 2064, 936}, // J6o
+        {8478, 2150, 978}, // Q6o
+        {9437, 2237, 1024}, // K6o
+        {10443, 2395, 1109}, // A6o
+        {7774, 1357, 594}, // 72s
+        {8480, 1466, 642}, // 73s
+        {9427, 1579, 698}, // 74s
+        {10170, 1687, 752}, // 75s
+        {10997, 1687, 754}, // 76s
+        {14031, 524, 209}, // 77
+        {9186, 1766, 795}, // 87o
+        {9083, 1797, 810}, // 97o
+        {8961, 1983, 895}, // T7o
+        {8868, 1968, 886}, // J7o
+        {8900, 1973, 893}, // Q7o
+        {9973, 2124, 974}, // K7o
+        {10977, 2326, 1071}, // A7o
+        {8018, 1473, 649}, // 82s
+        {8143, 1527, 671}, // 83s
+        {8990, 1650, 728}, // 84s
+        {9856, 1759, 786}, // 85s
+        {10758, 1741, 777}, // 86s
+        {11697, 1724, 776}, // 87s
+        {15550, 539, 218}, // 88
+        {10026, 1805, 811}, // 98o
+        {10193, 1913, 862}, // T8o
+        {10113, 1899, 859}, // J8o
+        {10149, 1879, 852}, // Q8o
+        {10445, 1973, 896}, // K8o
+        {11570, 2280, 1046}, // A8o
+        {8370, 1523, 666}, // 92s
+        {8651, 1631, 725}, // 93s
+        {8771, 1672, 743}, // 94s
+        {9589, 1806, 804}, // 95s
+        {10606, 1741, 784}, // 96s
+        {11579, 1738, 779}, // 97s
+        {12458, 1743, 781}, // 98s
+        {17240, 534, 219}, // 99
+        {11718, 1873, 846}, // T9o
+        {11419, 1834, 823}, // J9o
+        {11510, 1842, 831}, // Q9o
+        {11945, 1837, 833}, // K9o
+        {12277, 2061, 945}, // A9o
+        {8916, 1711, 761}, // T2s
+        {9203, 1786, 795}, // T3s
+        {9381, 1901, 854}, // T4s
+        {9596, 1966, 882}, // T5s
+        {10478, 1919, 868}, // T6s
+        {11549, 1860, 833}, // T7s
+        {12590, 1831, 827}, // T8s
+        {13871, 1796, 806}, // T9s
+        {19260, 613, 259}, // TT
+        {13275, 1816, 826}, // JTo
+        {13355, 1813, 818}, // QTo
+        {13761, 1837, 838}, // KTo
+        {14215, 1992, 912}, // ATo
+        {9545, 1704, 763}, // J2s
+        {9727, 1816, 813}, // J3s
+        {9924, 1893, 850}, // J4s
+        {10190, 2000, 900}, // J5s
+        {10530, 1903, 855}, // J6s
+        {11537, 1871, 842}, // J7s
+        {12675, 1781, 796}, // J8s
+        {13921, 1736, 777}, // J9s
+        {15415, 1765, 795}, // JTs
+        {21825, 543, 230}, // JJ
+        {14327, 1638, 738}, // QJo
+        {14688, 1653, 743}, // KJo
+        {15114, 1763, 803}, // AJo
+        {10185, 1774, 796}, // Q2s
+        {10423, 1864, 840}, // Q3s
+        {10725, 1930, 870}, // Q4s
+        {10793, 2050, 927}, // Q5s
+        {11291, 1999, 905}, // Q6s
+        {11653, 1887, 852}, // Q7s
+        {12810, 1802, 815}, // Q8s
+        {14072, 1719, 777}, // Q9s
+        {15704, 1786, 806}, // QTs
+        {16457, 1619, 730}, // QJs
+        {24564, 457, 189}, // QQ
+        {15763, 1470, 661}, // KQo
+        {16325, 1560, 710}, // AQo
+        {11103, 1905, 863}, // K2s
+        {11355, 1992, 902}, // K3s
+        {11533, 2081, 946}, // K4s
+        {11792, 2175, 991}, // K5s
+        {12121, 2117, 964}, // K6s
+        {12638, 2029, 924}, // K7s
+        {13140, 1925, 877}, // K8s
+        {14416, 1763, 795}, // K9s
+        {16185, 1778, 808}, // KTs
+        {16939, 1599, 719}, // KJs
+        {18007, 1425, 638}, // KQs
+        {28108, 399, 159}, // KK
+        {17599, 1323, 597}, // AKo
+        {12558, 2178, 998}, // A2s
+        {12792, 2280, 1051}, // A3s
+        {13163, 2418, 1116}, // A4s
+        {13434, 2421, 1115}, // A5s
+        {12985, 2350, 1082}, // A6s
+        {13591, 2285, 1052}, // A7s
+        {14249, 2133, 979}, // A8s
+        {14907, 1971, 899}, // A9s
+        {16644, 1839, 838}, // ATs
+        {17457, 1696, 770}, // AJs
+        {18655, 1493, 674}, // AQs
+        {19853, 1278, 573}, // AKs
+        {32175, 361, 143}  // AA
+    },
+    { // 6 opponents
+        {9189, 302, 85}, // 22
+        {4640, 1033, 439}, // 32o
+        {4819, 1175, 507}, // 42o
+        {5083, 1319, 577}, // 52o
+        {4569, 1256, 544}, // 62o
+        {4085, 1381, 603}, // 72o
+        {4339, 1415, 622}, // 82o
+        {4563, 1485, 656}, // 92o
+        {4990, 1679, 744}, // T2o
+        {5519, 1693, 755}, // J2o
+        {6054, 1683, 753}, // Q2o
+        {6810, 1811, 818}, // K2o
+        {8014, 2140, 982}, // A2o
+        {7264, 1009, 428}, // 32s
+        {9431, 379, 127}, // 33
+        {5476, 1321, 578}, // 43o
+        {5877, 1470, 644}, // 53o
+        {5286, 1359, 597}, // 63o
+        {4804, 1429, 629}, // 73o
+        {4457, 1527, 670}, // 83o
+        {4692, 1621, 715}, // 93o
+        {5190, 1803, 807}, // T3o
+        {5637, 1830, 820}, // J3o
+        {6160, 1817, 815}, // Q3o
+        {6950, 1964, 889}, // K3o
+        {8447, 2212, 1011}, // A3o
+        {7438, 1128, 485}, // 42s
+        {8078, 1237, 538}, // 43s
+        {9810, 438, 161}, // 44
+        {6551, 1586, 705}, // 54o
+        {6075, 1544, 685}, // 64o
+        {5651, 1575, 699}, // 74o
+        {5200, 1604, 711}, // 84o
+        {4906, 1686, 749}, // 94o
+        {5298, 1923, 861}, // T4o
+        {5763, 1909, 859}, // J4o
+        {6359, 2008, 905}, // Q4o
+        {7104, 2072, 939}, // K4o
+        {8496, 2411, 1106}, // A4o
+        {7667, 1262, 548}, // 52s
+        {8455, 1416, 622}, // 53s
+        {8916, 1534, 678}, // 54s
+        {10253, 549, 218}, // 55
+        {6725, 1642, 733}, // 65o
+        {6441, 1692, 757}, // 75o
+        {6051, 1703, 765}, // 85o
+        {5640, 1774, 789}, // 95o
+        {5571, 1991, 892}, // T5o
+        {6020, 2036, 917}, // J5o
+        {6639, 2060, 934}, // Q5o
+        {7394, 2199, 1001}, // K5o
+        {8831, 2450, 1126}, // A5o
+        {7226, 1155, 501}, // 62s
+        {7932, 1324, 577}, // 63s
+        {8636, 1455, 641}, // 64s
+        {9234, 1587, 709}, // 65s
+        {11146, 516, 211}, // 66
+        {7186, 1683, 753}, // 76o
+        {6848, 1756, 786}, // 86o
+        {6618, 1774, 795}, // 96o
+        {6465, 1958, 879}, // T6o
+        {6321, 1974, 890}, // J6o
+        {6955, 2046, 923}, // Q6o
+        {7703, 2175, 987}, // K6o
+        {8507, 2373, 1090}, // A6o
+        {6803, 1295, 565}, // 72s
+        {7511, 1373, 604}, // 73s
+        {8326, 1519, 672}, // 74s
+        {8963, 1588, 713}, // 75s
+        {9698, 1613, 718}, // 76s
+        {11939, 537, 222}, // 77
+        {7814, 1690, 761}, // 87o
+        {7670, 1748, 786}, // 97o
+        {7519, 1912, 860}, // T7o
+        {7260, 1884, 845}, // J7o
+        {7332, 1918, 866}, // Q7o
+        {8169, 2021, 920}, // K7o
+        {9023, 2268, 1037}, // A7o
+        {6989, 1370, 597}, // 82s
+        {7159, 1464, 643}, // 83s
+        {7847, 1554, 692}, // 84s
+        {8615, 1705, 760}, // 85s
+        {9490, 1620, 726}, // 86s
+        {10214, 1670, 750}, // 87s
+        {13049, 536, 220}, // 88
+        {8546, 1719, 773}, // 98o
+        {8574, 1926, 869}, // T8o
+        {8372, 1868, 844}, // J8o
+        {8461, 1833, 823}, // Q8o
+        {8644, 1943, 879}, // K8o
+        {9522, 2160, 987}, // A8o
+        {7331, 1399, 614}, // 92s
+        {7476, 1536, 678}, // 93s
+        {7591, 1643, 726}, // 94s
+        {8397, 1686, 754}, // 95s
+        {9242, 1677, 755}, // 96s
+        {9984, 1678, 758}, // 97s
+        {10958, 1667, 753}, // 98s
+        {14483, 560, 234}, // 99
+        {9788, 1829, 826}, // T9o
+        {9651, 1818, 818}, // J9o
+        {9684, 1764, 795}, // Q9o
+        {9897, 1820, 822}, // K9o
+        {10264, 2010, 914}, // A9o
+        {7822, 1606, 714}, // T2s
+        {7989, 1696, 755}, // T3s
+        {8138, 1842, 826}, // T4s
+        {8260, 1921, 860}, // T5s
+        {9061, 1873, 844}, // T6s
+        {9988, 1831, 823}, // T7s
+        {11043, 1786, 802}, // T8s
+        {12209, 1759, 794}, // T9s
+        {16203, 629, 275}, // TT
+        {11329, 1842, 835}, // JTo
+        {11458, 1820, 824}, // QTo
+        {11637, 1833, 831}, // KTo
+        {12146, 1967, 895}, // ATo
+        {8314, 1557, 694}, // J2s
+        {8451, 1719, 768}, // J3s
+        {8595, 1789, 801}, // J4s
+        {8770, 1891, 849}, // J5s
+        {8962, 1888, 847}, // J6s
+        {9850, 1821, 820}, // J7s
+        {10989, 1712, 770}, // J8s
+        {12074, 1734, 782}, // J9s
+        {13648, 1772, 797}, // JTs
+        {18445, 554, 238}, // JJ
+        {12246, 1653, 745}, // QJo
+        {12493, 1654, 752}, // KJo
+        {12946, 1770, 805}, // AJo
+        {8895, 1633, 732}, // Q2s
+        {9119, 1769, 797}, // Q3s
+        {9125, 1892, 848}, // Q4s
+        {9379, 1979, 891}, // Q5s
+        {9681, 1922, 865}, // Q6s
+        {10099, 1833, 827}, // Q7s
+        {11001, 1783, 803}, // Q8s
+        {12251, 1711, 769}, // Q9s
+        {13778, 1705, 772}, // QTs
+        {14467, 1581, 712}, // QJs
+        {21205, 471, 200}, // QQ
+        {13555, 1473, 667}, // KQo
+        {14099, 1541, 698}, // AQo
+        {9584, 1790, 811}, // K2s
+        {9829, 1894, 857}, // K3s
+        {9953, 2016, 911}, // K4s
+        {10266, 2090, 948}, // K5s
+        {10500, 2063, 939}, // K6s
+        {10875, 2023, 918}, // K7s
+        {11393, 1794, 812}, // K8s
+        {12455, 1727, 780}, // K9s
+        {14211, 1764, 796}, // KTs
+        {14964, 1609, 723}, // KJs
+        {15814, 1392, 628}, // KQs
+        {24235, 401, 165}, // KK
+        {15435, 1345, 605}, // AKo
+        {10997, 2057, 939}, // A2s
+        {11289, 2184, 1002}, // A3s
+        {11461, 2323, 1069}, // A4s
+        {11645, 2349, 1079}, // A5s
+        {11283, 2246, 1029}, // A6s
+        {11813, 2215, 1012}, // A7s
+        {12350, 2076, 947}, // A8s
+        {12914, 1917, 870}, // A9s
+        {14559, 1861, 848}, // ATs
+        {15401, 1649, 749}, // AJs
+        {16320, 1522, 683}, // AQs
+        {17597, 1271, 572}, // AKs
+        {28368, 354, 145}  // AA
+    },
+    { // 7 opponents
+        {8628, 253, 73}, // 22
+        {4111, 947, 407}, // 32o
+        {4339, 1145, 494}, // 42o
+        {4429, 1277, 563}, // 52o
+        {3899, 1226, 533}, // 62o
+        {3468, 1295, 568}, // 72o
+        {3614, 1337, 587}, // 82o
+        {3879, 1433, 628}, // 92o
+        {4247, 1599, 710}, // T2o
+        {4588, 1562, 691}, // J2o
+        {5048, 1590, 707}, // Q2o
+        {5754, 1750, 786}, // K2o
+        {6862, 2018, 922}, // A2o
+        {6546, 933, 400}, // 32s
+        {8665, 346, 120}, // 33
+        {4858, 1258, 545}, // 43o
+        {5147, 1393, 614}, // 53o
+        {4614, 1298, 569}, // 63o
+        {4137, 1361, 599}, // 73o
+        {3673, 1454, 638}, // 83o
+        {3946, 1561, 689}, // 93o
+        {4348, 1759, 778}, // T3o
+        {4701, 1745, 776}, // J3o
+        {5182, 1763, 786}, // Q3o
+        {5857, 1862, 841}, // K3o
+        {7175, 2152, 984}, // A3o
+        {6808, 1051, 453}, // 42s
+        {7324, 1206, 524}, // 43s
+        {8932, 466, 180}, // 44
+        {5735, 1501, 661}, // 54o
+        {5394, 1460, 647}, // 64o
+        {4851, 1484, 658}, // 74o
+        {4484, 1542, 684}, // 84o
+        {4111, 1657, 731}, // 94o
+        {4394, 1897, 843}, // T4o
+        {4847, 1821, 810}, // J4o
+        {5387, 1922, 864}, // Q4o
+        {5964, 1994, 902}, // K4o
+        {7362, 2308, 1054}, // A4o
+        {7004, 1212, 530}, // 52s
+        {7596, 1349, 591}, // 53s
+        {8146, 1499, 665}, // 54s
+        {9222, 557, 226}, // 55
+        {5899, 1589, 707}, // 65o
+        {5618, 1578, 704}, // 75o
+        {5166, 1695, 754}, // 85o
+        {4814, 1746, 776}, // 95o
+        {4591, 1996, 890}, // T5o
+        {4961, 1988, 888}, // J5o
+        {5518, 1998, 895}, // Q5o
+        {6176, 2110, 954}, // K5o
+        {7507, 2407, 1100}, // A5o
+        {6440, 1164, 506}, // 62s
+        {7099, 1275, 559}, // 63s
+        {7780, 1401, 618}, // 64s
+        {8364, 1511, 673}, // 65s
+        {9751, 549, 223}, // 66
+        {6337, 1591, 709}, // 76o
+        {6018, 1693, 754}, // 86o
+        {5573, 1717, 770}, // 96o
+        {5362, 1912, 855}, // T6o
+        {5202, 1933, 867}, // J6o
+        {5764, 1987, 891}, // Q6o
+        {6522, 2048, 932}, // K6o
+        {7207, 2262, 1031}, // A6o
+        {6124, 1223, 532}, // 72s
+        {6691, 1279, 558}, // 73s
+        {7414, 1457, 644}, // 74s
+        {8114, 1563, 692}, // 75s
+        {8692, 1511, 677}, // 76s
+        {10508, 519, 216}, // 77
+        {6744, 1622, 726}, // 87o
+        {6544, 1737, 773}, // 97o
+        {6352, 1886, 848}, // T7o
+        {6148, 1901, 850}, // J7o
+        {6089, 1870, 837}, // Q7o
+        {6778, 2002, 900}, // K7o
+        {7560, 2232, 1016}, // A7o
+        {6273, 1285, 562}, // 82s
+        {6428, 1391, 608}, // 83s
+        {7054, 1488, 654}, // 84s
+        {7727, 1581, 698}, // 85s
+        {8513, 1590, 705}, // 86s
+        {9152, 1619, 720}, // 87s
+        {11382, 533, 224}, // 88
+        {7342, 1689, 758}, // 98o
+        {7305, 1887, 843}, // T8o
+        {7190, 1809, 810}, // J8o
+        {7058, 1860, 835}, // Q8o
+        {7333, 1908, 858}, // K8o
+        {8101, 2102, 955}, // A8o
+        {6522, 1342, 589}, // 92s
+        {6625, 1473, 648}, // 93s
+        {6743, 1569, 692}, // 94s
+        {7446, 1683, 745}, // 95s
+        {8213, 1647, 734}, // 96s
+        {9017, 1613, 723}, // 97s
+        {9724, 1629, 728}, // 98s
+        {12469, 548, 232}, // 99
+        {8519, 1827, 821}, // T9o
+        {8221, 1786, 801}, // J9o
+        {8257, 1706, 767}, // Q9o
+        {8417, 1773, 799}, // K9o
+        {8752, 1942, 876}, // A9o
+        {6964, 1536, 677}, // T2s
+        {7046, 1644, 730}, // T3s
+        {7139, 1797, 796}, // T4s
+        {7261, 1891, 838}, // T5s
+        {8087, 1817, 813}, // T6s
+        {8943, 1834, 824}, // T7s
+        {9754, 1764, 794}, // T8s
+        {10761, 1729, 778}, // T9s
+        {13868, 694, 305}, // TT
+        {9924, 1881, 848}, // JTo
+        {9849, 1823, 826}, // QTo
+        {10120, 1860, 846}, // KTo
+        {10356, 1930, 873}, // ATo
+        {7369, 1520, 676}, // J2s
+        {7461, 1617, 718}, // J3s
+        {7620, 1779, 796}, // J4s
+        {7755, 1894, 843}, // J5s
+        {7972, 1814, 813}, // J6s
+        {8762, 1792, 802}, // J7s
+        {9742, 1711, 765}, // J8s
+        {10709, 1687, 755}, // J9s
+        {12148, 1775, 799}, // JTs
+        {15922, 586, 256}, // JJ
+        {10562, 1625, 733}, // QJo
+        {10862, 1645, 742}, // KJo
+        {11112, 1715, 778}, // AJo
+        {7952, 1559, 701}, // Q2s
+        {8071, 1665, 743}, // Q3s
+        {8222, 1834, 820}, // Q4s
+        {8252, 1920, 860}, // Q5s
+        {8543, 1868, 842}, // Q6s
+        {8876, 1796, 803}, // Q7s
+        {9695, 1738, 778}, // Q8s
+        {10759, 1671, 745}, // Q9s
+        {12235, 1749, 790}, // QTs
+        {12858, 1615, 723}, // QJs
+        {18284, 514, 224}, // QQ
+        {11746, 1439, 653}, // KQo
+        {12173, 1558, 706}, // AQo
+        {8608, 1668, 751}, // K2s
+        {8751, 1762, 797}, // K3s
+        {8802, 1930, 867}, // K4s
+        {8947, 2011, 903}, // K5s
+        {9237, 1966, 887}, // K6s
+        {9524, 1907, 859}, // K7s
+        {10017, 1783, 801}, // K8s
+        {11135, 1734, 783}, // K9s
+        {12532, 1738, 785}, // KTs
+        {13373, 1566, 704}, // KJs
+        {14124, 1435, 643}, // KQs
+        {21362, 405, 171}, // KK
+        {13538, 1305, 591}, // AKo
+        {9757, 1953, 893}, // A2s
+        {10004, 2089, 955}, // A3s
+        {10153, 2214, 1009}, // A4s
+        {10302, 2303, 1050}, // A5s
+        {10020, 2171, 991}, // A6s
+        {10379, 2136, 972}, // A7s
+        {10884, 2020, 913}, // A8s
+        {11475, 1859, 842}, // A9s
+        {12918, 1872, 850}, // ATs
+        {13567, 1673, 759}, // AJs
+        {14533, 1518, 686}, // AQs
+        {15742, 1275, 579}, // AKs
+        {25226, 353, 146}  // AA
+    },
+    { // 8 opponents
+        {8147, 223, 66}, // 22
+        {3628, 956, 412}, // 32o
+        {3838, 1090, 470}, // 42o
+        {3971, 1280, 558}, // 52o
+        {3446, 1194, 517}, // 62o
+        {2976, 1244, 540}, // 72o
+        {3155, 1336, 582}, // 82o
+        {3304, 1363, 593}, // 92o
+        {3607, 1546, 680}, // T2o
+        {3986, 1549, 685}, // J2o
+        {4360, 1546, 686}, // Q2o
+        {4938, 1636, 737}, // K2o
+        {5986, 1924, 876}, // A2o
+        {6060, 894, 383}, // 32s
+        {8184, 326, 118}, // 33
+        {4406, 1214, 530}, // 43o
+        {4666, 1410, 622}, // 53o
+        {4077, 1291, 566}, // 63o
+        {3560, 1340, 587}, // 73o
+        {3221, 1410, 616}, // 83o
+        {3376, 1519, 667}, // 93o
+        {3634, 1658, 727}, // T3o
+        {4035, 1710, 754}, // J3o
+        {4429, 1705, 759}, // Q3o
+        {4974, 1791, 805}, // K3o
+        {6122, 2090, 952}, // A3o
+        {6223, 1061, 458}, // 42s
+        {6855, 1176, 512}, // 43s
+        {8262, 457, 180}, // 44
+        {5151, 1527, 675}, // 54o
+        {4818, 1407, 622}, // 64o
+        {4270, 1450, 641}, // 74o
+        {3870, 1557, 687}, // 84o
+        {3413, 1612, 708}, // 94o
+        {3764, 1884, 827}, // T4o
+        {4063, 1825, 805}, // J4o
+        {4496, 1843, 818}, // Q4o
+        {5090, 1951, 877}, // K4o
+        {6321, 2198, 999}, // A4o
+        {6402, 1179, 519}, // 52s
+        {7098, 1348, 594}, // 53s
+        {7570, 1453, 642}, // 54s
+        {8481, 541, 224}, // 55
+        {5309, 1532, 678}, // 65o
+        {5032, 1618, 713}, // 75o
+        {4534, 1623, 721}, // 85o
+        {4118, 1713, 753}, // 95o
+        {3853, 2005, 884}, // T5o
+        {4212, 1935, 860}, // J5o
+        {4613, 1941, 865}, // Q5o
+        {5268, 2065, 928}, // K5o
+        {6446, 2307, 1048}, // A5o
+        {5866, 1130, 494}, // 62s
+        {6617, 1200, 528}, // 63s
+        {7163, 1371, 605}, // 64s
+        {7758, 1491, 660}, // 65s
+        {8972, 545, 225}, // 66
+        {5560, 1594, 705}, // 76o
+        {5298, 1623, 726}, // 86o
+        {4899, 1672, 743}, // 96o
+        {4629, 1903, 844}, // T6o
+        {4403, 1921, 846}, // J6o
+        {4833, 1916, 845}, // Q6o
+        {5462, 2000, 898}, // K6o
+        {6117, 2185, 986}, // A6o
+        {5509, 1205, 523}, // 72s
+        {6130, 1245, 546}, // 73s
+        {6815, 1359, 597}, // 74s
+        {7431, 1482, 657}, // 75s
+        {7941, 1510, 670}, // 76s
+        {9408, 555, 236}, // 77
+        {5967, 1602, 714}, // 87o
+        {5674, 1662, 741}, // 97o
+        {5467, 1871, 830}, // T7o
+        {5343, 1841, 813}, // J7o
+        {5192, 1834, 819}, // Q7o
+        {5773, 1973, 881}, // K7o
+        {6529, 2143, 961}, // A7o
+        {5721, 1227, 536}, // 82s
+        {5808, 1373, 606}, // 83s
+        {6415, 1451, 639}, // 84s
+        {7008, 1554, 684}, // 85s
+        {7709, 1539, 680}, // 86s
+        {8368, 1532, 687}, // 87s
+        {10102, 550, 233}, // 88
+        {6486, 1607, 714}, // 98o
+        {6407, 1872, 836}, // T8o
+        {6173, 1775, 789}, // J8o
+        {6064, 1759, 784}, // Q8o
+        {6236, 1836, 820}, // K8o
+        {6891, 2027, 912}, // A8o
+        {5924, 1269, 555}, // 92s
+        {5968, 1414, 621}, // 93s
+        {6056, 1562, 685}, // 94s
+        {6595, 1611, 713}, // 95s
+        {7504, 1573, 699}, // 96s
+        {8129, 1574, 697}, // 97s
+        {8842, 1559, 696}, // 98s
+        {11026, 547, 232}, // 99
+        {7519, 1837, 821}, // T9o
+        {7196, 1744, 783}, // J9o
+        {7166, 1685, 750}, // Q9o
+        {7342, 1764, 787}, // K9o
+        {7430, 1868, 837}, // A9o
+        {6331, 1502, 660}, // T2s
+        {6361, 1626, 718}, // T3s
+        {6495, 1724, 760}, // T4s
+        {6457, 1838, 811}, // T5s
+        {7141, 1794, 792}, // T6s
+        {7934, 1749, 778}, // T7s
+        {8910, 1772, 790}, // T8s
+        {9838, 1773, 789}, // T9s
+        {12281, 713, 316}, // TT
+        {8692, 1854, 834}, // JTo
+        {8626, 1845, 827}, // QTo
+        {8760, 1821, 818}, // KTo
+        {8982, 1910, 858}, // ATo
+        {6719, 1452, 644}, // J2s
+        {6716, 1594, 705}, // J3s
+        {6835, 1686, 746}, // J4s
+        {6919, 1837, 815}, // J5s
+        {7090, 1791, 800}, // J6s
+        {7881, 1733, 769}, // J7s
+        {8779, 1731, 766}, // J8s
+        {9669, 1641, 736}, // J9s
+        {11064, 1802, 811}, // JTs
+        {13965, 580, 257}, // JJ
+        {9270, 1647, 741}, // QJo
+        {9480, 1656, 745}, // KJo
+        {9796, 1699, 766}, // AJo
+        {7245, 1433, 640}, // Q2s
+        {7254, 1582, 704}, // Q3s
+        {7367, 1746, 774}, // Q4s
+        {7406, 1866, 832}, // Q5s
+        {7572, 1824, 807}, // Q6s
+        {7916, 1799, 798}, // Q7s
+        {8689, 1661, 739}, // Q8s
+        {9726, 1618, 723}, // Q9s
+        {11107, 1760, 788}, // QTs
+        {11621, 1602, 719}, // QJs
+        {16115, 492, 210}, // QQ
+        {10481, 1423, 638}, // KQo
+        {10684, 1512, 682}, // AQo
+        {7798, 1603, 719}, // K2s
+        {7852, 1714, 773}, // K3s
+        {7915, 1815, 811}, // K4s
+        {8145, 1937, 870}, // K5s
+        {8399, 1909, 859}, // K6s
+        {8688, 1828, 814}, // K7s
+        {8934, 1710, 762}, // K8s
+        {9958, 1699, 758}, // K9s
+        {11373, 1750, 785}, // KTs
+        {11981, 1551, 699}, // KJs
+        {12752, 1399, 628}, // KQs
+        {18982, 400, 172}, // KK
+        {12040, 1282, 582}, // AKo
+        {8832, 1835, 833}, // A2s
+        {9037, 1937, 877}, // A3s
+        {9142, 2142, 972}, // A4s
+        {9329, 2202, 997}, // A5s
+        {8995, 2149, 976}, // A6s
+        {9336, 1979, 895}, // A7s
+        {9816, 1945, 874}, // A8s
+        {10149, 1810, 809}, // A9s
+        {11697, 1819, 821}, // ATs
+        {12302, 1687, 758}, // AJs
+        {13143, 1496, 675}, // AQs
+        {14206, 1278, 578}, // AKs
+        {22399, 338, 146}  // AA
+    },
+    { // 9 opponents
+        {7729, 208, 63}, // 22
+        {3213, 911, 397}, // 32o
+        {3479, 1046, 459}, // 42o
+        {3527, 1230, 537}, // 52o
+        {3040, 1136, 491}, // 62o
+        {2651, 1219, 524}, // 72o
+        {2649, 1282, 558}, // 82o
+        {2889, 1297, 566}, // 92o
+        {3104, 1555, 678}, // T2o
+        {3460, 1501, 658}, // J2o
+        {3809, 1451, 638}, // Q2o
+        {4372, 1530, 682}, // K2o
+        {5211, 1769, 796}, // A2o
+        {5666, 870, 376}, // 32s
+        {7759, 320, 120}, // 33
+        {3987, 1199, 525}, // 43o
+        {4134, 1385, 604}, // 53o
+        {3729, 1237, 544}, // 63o
+        {3201, 1291, 566}, // 73o
+        {2785, 1405, 603}, // 83o
+        {2887, 1464, 633}, // 93o
+        {3136, 1667, 722}, // T3o
+        {3435, 1633, 714}, // J3o
+        {3832, 1594, 705}, // Q3o
+        {4348, 1688, 751}, // K3o
+        {5411, 1930, 874}, // A3o
+        {5887, 1014, 439}, // 42s
+        {6320, 1159, 506}, // 43s
+        {7770, 430, 172}, // 44
+        {4706, 1501, 662}, // 54o
+        {4345, 1442, 631}, // 64o
+        {3856, 1444, 636}, // 74o
+        {3298, 1521, 666}, // 84o
+        {2920, 1587, 686}, // 94o
+        {3220, 1810, 789}, // T4o
+        {3502, 1749, 760}, // J4o
+        {3914, 1744, 771}, // Q4o
+        {4455, 1874, 831}, // K4o
+        {5547, 2106, 951}, // A4o
+        {5912, 1192, 517}, // 52s
+        {6590, 1312, 577}, // 53s
+        {7047, 1451, 642}, // 54s
+        {7922, 565, 233}, // 55
+        {4809, 1547, 683}, // 65o
+        {4481, 1596, 702}, // 75o
+        {3987, 1597, 700}, // 85o
+        {3525, 1656, 721}, // 95o
+        {3314, 1964, 857}, // T5o
+        {3610, 1917, 840}, // J5o
+        {3958, 1884, 828}, // Q5o
+        {4510, 1948, 864}, // K5o
+        {5663, 2215, 997}, // A5o
+        {5440, 1054, 460}, // 62s
+        {6121, 1211, 528}, // 63s
+        {6680, 1373, 608}, // 64s
+        {7128, 1480, 656}, // 65s
+        {8289, 545, 230}, // 66
+        {5036, 1597, 707}, // 76o
+        {4753, 1593, 705}, // 86o
+        {4308, 1645, 721}, // 96o
+        {4018, 1888, 826}, // T6o
+        {3861, 1878, 820}, // J6o
+        {4178, 1924, 847}, // Q6o
+        {4737, 1941, 858}, // K6o
+        {5361, 2145, 961}, // A6o
+        {5026, 1143, 494}, // 72s
+        {5556, 1251, 545}, // 73s
+        {6232, 1419, 624}, // 74s
+        {6800, 1505, 662}, // 75s
+        {7333, 1505, 666}, // 76s
+        {8730, 562, 237}, // 77
+        {5354, 1583, 706}, // 87o
+        {5098, 1634, 721}, // 97o
+        {4772, 1838, 807}, // T7o
+        {4521, 1807, 795}, // J7o
+        {4404, 1858, 817}, // Q7o
+        {5029, 1903, 840}, // K7o
+        {5625, 2064, 920}, // A7o
+        {5230, 1201, 521}, // 82s
+        {5258, 1319, 569}, // 83s
+        {5808, 1433, 625}, // 84s
+        {6468, 1516, 669}, // 85s
+        {7084, 1494, 657}, // 86s
+        {7637, 1547, 688}, // 87s
+        {9334, 573, 244}, // 88
+        {5728, 1615, 715}, // 98o
+        {5694, 1862, 823}, // T8o
+        {5425, 1729, 763}, // J8o
+        {5289, 1735, 768}, // Q8o
+        {5363, 1783, 788}, // K8o
+        {5974, 1919, 854}, // A8o
+        {5396, 1245, 541}, // 92s
+        {5458, 1386, 601}, // 93s
+        {5518, 1487, 647}, // 94s
+        {6095, 1556, 680}, // 95s
+        {6801, 1554, 683}, // 96s
+        {7531, 1569, 693}, // 97s
+        {8129, 1511, 671}, // 98s
+        {9959, 542, 231}, // 99
+        {6605, 1829, 806}, // T9o
+        {6350, 1745, 768}, // J9o
+        {6205, 1666, 739}, // Q9o
+        {6330, 1692, 749}, // K9o
+        {6471, 1842, 820}, // A9o
+        {5710, 1434, 626}, // T2s
+        {5799, 1580, 687}, // T3s
+        {5844, 1708, 745}, // T4s
+        {5869, 1852, 811}, // T5s
+        {6579, 1788, 783}, // T6s
+        {7331, 1736, 765}, // T7s
+        {8067, 1773, 781}, // T8s
+        {8963, 1702, 758}, // T9s
+        {10927, 735, 328}, // TT
+        {7790, 1861, 831}, // JTo
+        {7723, 1826, 811}, // QTo
+        {7794, 1820, 808}, // KTo
+        {8004, 1872, 834}, // ATo
+        {6128, 1410, 615}, // J2s
+        {6120, 1522, 663}, // J3s
+        {6208, 1644, 716}, // J4s
+        {6247, 1805, 793}, // J5s
+        {6442, 1813, 793}, // J6s
+        {7092, 1736, 765}, // J7s
+        {7954, 1658, 732}, // J8s
+        {8805, 1636, 723}, // J9s
+        {10007, 1775, 788}, // JTs
+        {12314, 611, 271}, // JJ
+        {8252, 1640, 734}, // QJo
+        {8379, 1640, 726}, // KJo
+        {8628, 1672, 750}, // AJo
+        {6560, 1391, 611}, // Q2s
+        {6583, 1565, 693}, // Q3s
+        {6711, 1697, 747}, // Q4s
+        {6779, 1799, 790}, // Q5s
+        {6902, 1783, 787}, // Q6s
+        {7208, 1708, 751}, // Q7s
+        {7928, 1626, 716}, // Q8s
+        {8873, 1581, 696}, // Q9s
+        {10034, 1719, 767}, // QTs
+        {10628, 1570, 700}, // QJs
+        {14274, 502, 220}, // QQ
+        {9242, 1442, 650}, // KQo
+        {9524, 1499, 676}, // AQo
+        {7218, 1441, 647}, // K2s
+        {7165, 1624, 727}, // K3s
+        {7307, 1728, 770}, // K4s
+        {7376, 1869, 833}, // K5s
+        {7569, 1828, 808}, // K6s
+        {7781, 1790, 794}, // K7s
+        {8150, 1693, 746}, // K8s
+        {8967, 1593, 706}, // K9s
+        {10324, 1685, 752}, // KTs
+        {10911, 1524, 683}, // KJs
+        {11619, 1338, 601}, // KQs
+        {16872, 412, 179}, // KK
+        {10671, 1284, 586}, // AKo
+        {8166, 1733, 790}, // A2s
+        {8337, 1832, 828}, // A3s
+        {8405, 2039, 920}, // A4s
+        {8493, 2156, 970}, // A5s
+        {8209, 1996, 894}, // A6s
+        {8452, 1956, 876}, // A7s
+        {8789, 1832, 816}, // A8s
+        {9287, 1773, 785}, // A9s
+        {10615, 1805, 806}, // ATs
+        {11182, 1623, 729}, // AJs
+        {11918, 1415, 639}, // AQs
+        {13071, 1248, 563}, // AKs
+        {20260, 325, 138}  // AA
+    }
+};
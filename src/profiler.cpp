@@ -0,0 +1,177 @@
+#include "profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+std::atomic<bool> Profiler::enabled_{false};
+
+namespace {
+
+struct Event {
+    const char* name;
+    uint64_t start;
+    uint64_t end;
+};
+
+// One ring-buffer slot under a per-slot seqlock: seq is the slot's event
+// number + 1 once written and BUSY while the owner rewrites it. The fields are
+// atomics so the exporter can read them while the owner writes; it keeps an
+// event only if seq showed the number it expected before and after the copy.
+struct Slot {
+    static constexpr uint64_t BUSY = ~uint64_t(0);
+    std::atomic<uint64_t> seq{0};
+    std::atomic<const char*> name{nullptr};
+    std::atomic<uint64_t> start{0};
+    std::atomic<uint64_t> end{0};
+};
+
+// Written only by its thread; head counts every event ever recorded
+struct ThreadBuffer {
+    explicit ThreadBuffer(uint32_t id) : tid(id) {}
+    const uint32_t tid;
+    std::atomic<uint64_t> head{0};
+    Slot slots[Profiler::EVENTS_PER_THREAD];
+};
+
+// Leaked on purpose: pool threads may still record while statics are destroyed.
+// A buffer whose thread exited goes back on the free list for the next new
+// thread, so short-lived pools do not grow the registry; its earlier events
+// stay in the trace on the same row.
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    std::vector<ThreadBuffer*> free;
+};
+
+constexpr size_t MAX_BUFFERS = 256; // Threads beyond this many live at once are not recorded
+
+Registry& registry() {
+    static Registry* instance = new Registry();
+    return *instance;
+}
+
+// Claims a buffer for the thread on first use and hands it back when the thread exits
+class BufferLease {
+public:
+    BufferLease() {
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        if (!r.free.empty()) {
+            buffer_ = r.free.back();
+            r.free.pop_back();
+        } else if (r.buffers.size() < MAX_BUFFERS) {
+            r.buffers.push_back(std::make_unique<ThreadBuffer>(static_cast<uint32_t>(r.buffers.size() + 1)));
+            buffer_ = r.buffers.back().get();
+        }
+    }
+    ~BufferLease() {
+        if (!buffer_) return;
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        r.free.push_back(buffer_);
+    }
+
+    BufferLease(const BufferLease&) = delete;
+    BufferLease& operator=(const BufferLease&) = delete;
+
+    ThreadBuffer* buffer() const { return buffer_; }
+
+private:
+    ThreadBuffer* buffer_ = nullptr;
+};
+
+ThreadBuffer* localBuffer() {
+    thread_local BufferLease lease;
+    return lease.buffer();
+}
+
+std::atomic<uint64_t> clearedAt{0};
+
+void writeEscaped(std::ofstream& out, const char* text) {
+    for (; *text; ++text) {
+        if (*text == '"' || *text == '\\') out << '\\';
+        out << *text;
+    }
+}
+
+} // namespace
+
+void Profiler::setEnabled(bool enabled) {
+    enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+uint64_t Profiler::nowNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void Profiler::record(const char* name, uint64_t startNs, uint64_t endNs) {
+    ThreadBuffer* buffer = localBuffer();
+    if (!buffer) return;
+    const uint64_t head = buffer->head.load(std::memory_order_relaxed);
+    Slot& slot = buffer->slots[head % EVENTS_PER_THREAD];
+    slot.seq.store(Slot::BUSY, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.start.store(startNs, std::memory_order_relaxed);
+    slot.end.store(endNs, std::memory_order_relaxed);
+    slot.seq.store(head + 1, std::memory_order_release);
+    buffer->head.store(head + 1, std::memory_order_release);
+}
+
+void Profiler::clear() {
+    clearedAt.store(nowNs(), std::memory_order_relaxed);
+}
+
+bool Profiler::writeChromeTrace(const std::string& path) {
+    std::ofstream out(path, std::ios::trunc);
+    if (!out) return false;
+
+    const uint64_t since = clearedAt.load(std::memory_order_relaxed);
+    std::vector<std::pair<uint32_t, Event>> events;
+    {
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        for (const auto& buffer : r.buffers) {
+            const uint64_t head = buffer->head.load(std::memory_order_acquire);
+            const uint64_t first = head > EVENTS_PER_THREAD ? head - EVENTS_PER_THREAD : 0;
+            for (uint64_t i = first; i < head; ++i) {
+                const Slot& slot = buffer->slots[i % EVENTS_PER_THREAD];
+                // Skip slots the thread is rewriting or has reused since head was read
+                if (slot.seq.load(std::memory_order_acquire) != i + 1) continue;
+                const Event event{slot.name.load(std::memory_order_relaxed),
+                                  slot.start.load(std::memory_order_relaxed),
+                                  slot.end.load(std::memory_order_relaxed)};
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (slot.seq.load(std::memory_order_relaxed) != i + 1) continue;
+                events.emplace_back(buffer->tid, event);
+            }
+        }
+    }
+    events.erase(std::remove_if(events.begin(), events.end(),
+                                [&](const std::pair<uint32_t, Event>& e) { return e.second.start < since; }),
+                 events.end());
+    const uint64_t origin = events.empty() ? 0 : std::min_element(events.begin(), events.end(),
+        [](const std::pair<uint32_t, Event>& a, const std::pair<uint32_t, Event>& b) {
+            return a.second.start < b.second.start;
+        })->second.start;
+
+    // Complete ("X") events, microseconds from the first recorded start
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    out.precision(3);
+    out << std::fixed;
+    bool first = true;
+    for (const auto& [tid, event] : events) {
+        out << (first ? "\n" : ",\n") << "{\"name\":\"";
+        writeEscaped(out, event.name);
+        out << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << tid
+            << ",\"ts\":" << (event.start - origin) / 1000.0
+            << ",\"dur\":" << (event.end - event.start) / 1000.0 << "}";
+        first = false;
+    }
+    out << "\n]}\n";
+    return static_cast<bool>(out);
+}
@@ -0,0 +1,70 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Build with -DPOKER_PROFILING=0 (CMake option POKER_PROFILING=OFF) to compile every PROFILE_SCOPE out
+#ifndef POKER_PROFILING
+#define POKER_PROFILING 1
+#endif
+
+// Scoped timers for the hot paths. Each thread records into its own ring
+// buffer with no locks; writeChromeTrace() exports what the buffers hold as
+// Chrome trace JSON for chrome://tracing or ui.perfetto.dev, safely while
+// threads keep recording. A thread's buffer is reused by a later thread once
+// it exits; at most 256 threads record at the same time. Off by default:
+// a disabled scope costs one relaxed atomic load.
+class Profiler {
+public:
+    static constexpr size_t EVENTS_PER_THREAD = 1 << 14; // Older events are overwritten
+
+    static void setEnabled(bool enabled);
+    static bool enabled() { return enabled_.load(std::memory_order_relaxed); }
+
+    // Monotonic nanoseconds, the timebase of every event
+    static uint64_t nowNs();
+
+    // One complete event on the calling thread's buffer. name must outlive the
+    // export (string literals). For spans that do not fit a scope, such as an
+    // asynchronous query measured from submission to result.
+    static void record(const char* name, uint64_t startNs, uint64_t endNs);
+
+    // Drops everything recorded so far from later exports
+    static void clear();
+
+    // False if the file cannot be written
+    static bool writeChromeTrace(const std::string& path);
+
+private:
+    static std::atomic<bool> enabled_;
+};
+
+// Records its lifetime when the profiler was enabled at construction
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name)
+        : name_(Profiler::enabled() ? name : nullptr), start_(name_ ? Profiler::nowNs() : 0) {}
+    ~ProfileScope() {
+        if (name_) Profiler::record(name_, start_, Profiler::nowNs());
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* name_;
+    uint64_t start_;
+};
+
+#if POKER_PROFILING
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_CONCAT(profileScope_, __LINE__)(name)
+#else
+#define PROFILE_SCOPE(name) static_cast<void>(0)
+#endif
+
+#endif // PROFILER_H
@@ -0,0 +1,218 @@
+#include "range.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+
+enum class Kind { Pair, Suited, Offsuit, Any };
+
+// A starting-hand class such as "AKs": ranks 0 = Two .. 12 = Ace, hi >= lo
+struct HandClass {
+    int hi = 0;
+    int lo = 0;
+    Kind kind = Kind::Any;
+};
+
+std::string trim(const std::string& text) {
+    size_t begin = 0, end = text.size();
+    while (begin < end && std::isspace(static_cast<unsigned char>(text[begin]))) ++begin;
+    while (end > begin && std::isspace(static_cast<unsigned char>(text[end - 1]))) --end;
+    return text.substr(begin, end - begin);
+}
+
+int parseRank(char c) {
+    static const char* ranks = "23456789TJQKA";
+    const char* rank = std::strchr(ranks, std::toupper(static_cast<unsigned char>(c)));
+    return rank && *rank ? static_cast<int>(rank - ranks) : -1;
+}
+
+// Parses "AK", "AKs", "AKo" or "QQ" at text[pos], advancing pos
+HandClass parseClass(const std::string& text, size_t& pos) {
+    if (pos + 2 > text.size())
+        throw std::invalid_argument("Truncated hand class in \"" + text + "\"");
+    const int first = parseRank(text[pos]);
+    const int second = parseRank(text[pos + 1]);
+    if (first < 0 || second < 0)
+        throw std::invalid_argument("Invalid ranks in \"" + text + "\"");
+    pos += 2;
+
+    HandClass result;
+    result.hi = std::max(first, second);
+    result.lo = std::min(first, second);
+    result.kind = first == second ? Kind::Pair : Kind::Any;
+    if (pos < text.size() && (text[pos] == 's' || text[pos] == 'o')) {
+        if (result.kind == Kind::Pair)
+            throw std::invalid_argument("Pairs cannot be suited or offsuit in \"" + text + "\"");
+        result.kind = text[pos] == 's' ? Kind::Suited : Kind::Offsuit;
+        ++pos;
+    }
+    return result;
+}
+
+void addClass(Range& range, const HandClass& handClass, double weight) {
+    for (int suit1 = 0; suit1 < 4; ++suit1) {
+        for (int suit2 = 0; suit2 < 4; ++suit2) {
+            const bool suited = suit1 == suit2;
+            if (handClass.kind == Kind::Pair && suit1 >= suit2) continue;
+            if (handClass.kind == Kind::Suited && !suited) continue;
+            if (handClass.kind == Kind::Offsuit && suited) continue;
+            CardSet hole;
+            hole.add(suit1 * 13 + handClass.hi);
+            hole.add(suit2 * 13 + handClass.lo);
+            range.set(hole, weight);
+        }
+    }
+}
+
+void parseToken(Range& range, const std::string& token) {
+    std::string body = token;
+    double weight = 1.0;
+    const size_t colon = token.find(':');
+    if (colon != std::string::npos) {
+        body = trim(token.substr(0, colon));
+        const std::string weightText = trim(token.substr(colon + 1));
+        char* end = nullptr;
+        weight = std::strtod(weightText.c_str(), &end);
+        if (weightText.empty() || *end != '\0' || weight < 0.0 || weight > 1.0)
+            throw std::invalid_argument("Invalid weight in \"" + token + "\"");
+    }
+
+    // Specific holding such as "AhKh"
+    if (body.size() == 4 && std::strchr("hdcs", body[1]) && std::strchr("hdcs", body[3])) {
+        const CardSet hole = CardSet::fromPokerStoveString(body);
+        if (hole.size() != 2) throw std::invalid_argument("Duplicate card in \"" + token + "\"");
+        range.set(hole, weight);
+        return;
+    }
+
+    size_t pos = 0;
+    const HandClass first = parseClass(body, pos);
+    if (pos == body.size()) {
+        addClass(range, first, weight);
+    } else if (body[pos] == '+' && pos + 1 == body.size()) {
+        // QQ+ climbs the pairs, A2s+ climbs the kicker up to just below the top card
+        HandClass handClass = first;
+        if (first.kind == Kind::Pair) {
+            for (int rank = first.hi; rank <= 12; ++rank) {
+                handClass.hi = handClass.lo = rank;
+                addClass(range, handClass, weight);
+            }
+        } else {
+            for (int lo = first.lo; lo < first.hi; ++lo) {
+                handClass.lo = lo;
+                addClass(range, handClass, weight);
+            }
+        }
+    } else if (body[pos] == '-') {
+        ++pos;
+        const HandClass last = parseClass(body, pos);
+        if (pos != body.size() || last.kind != first.kind)
+            throw std::invalid_argument("Invalid span \"" + token + "\"");
+        HandClass handClass = first;
+        if (first.kind == Kind::Pair) {
+            for (int rank = std::min(first.hi, last.hi); rank <= std::max(first.hi, last.hi); ++rank) {
+                handClass.hi = handClass.lo = rank;
+                addClass(range, handClass, weight);
+            }
+        } else if (first.hi == last.hi) {
+            // A5s-A2s: fixed top card, kicker span
+            for (int lo = std::min(first.lo, last.lo); lo <= std::max(first.lo, last.lo); ++lo) {
+                handClass.lo = lo;
+                addClass(range, handClass, weight);
+            }
+        } else if (first.hi - first.lo == last.hi - last.lo) {
+            // 76s-54s: both cards step down together
+            const int gap = first.hi - first.lo;
+            for (int hi = std::min(first.hi, last.hi); hi <= std::max(first.hi, last.hi); ++hi) {
+                handClass.hi = hi;
+                handClass.lo = hi - gap;
+                addClass(range, handClass, weight);
+            }
+        } else {
+            throw std::invalid_argument("Span ends need the same top card or gap in \"" + token + "\"");
+        }
+    } else {
+        throw std::invalid_argument("Invalid range token \"" + token + "\"");
+    }
+}
+
+struct ComboTable {
+    CardSet cards[Range::NUM_COMBOS];
+    ComboTable() {
+        for (int b = 1; b < 52; ++b) {
+            for (int a = 0; a < b; ++a) {
+                CardSet hole;
+                hole.add(a);
+                hole.add(b);
+                cards[b * (b - 1) / 2 + a] = hole;
+            }
+        }
+    }
+};
+
+} // namespace
+
+Range Range::parse(const std::string& text) {
+    Range range;
+    size_t begin = 0;
+    while (begin <= text.size()) {
+        size_t end = text.find(',', begin);
+        if (end == std::string::npos) end = text.size();
+        const std::string token = trim(text.substr(begin, end - begin));
+        if (!token.empty()) parseToken(range, token);
+        begin = end + 1;
+    }
+    return range;
+}
+
+Range Range::all() {
+    Range range;
+    range.weights_.fill(1.0f);
+    return range;
+}
+
+Range Range::single(CardSet holeCards) {
+    Range range;
+    range.set(holeCards, 1.0);
+    return range;
+}
+
+int Range::comboIndex(CardSet holeCards) {
+    if (holeCards.size() != 2) return -1;
+    const uint64_t m = holeCards.mask();
+    const int a = CardSet::lowestIndex(m);
+    const int b = CardSet::lowestIndex(m & (m - 1));
+    return b * (b - 1) / 2 + a;
+}
+
+CardSet Range::comboCards(int index) {
+    static const ComboTable table;
+    return table.cards[index];
+}
+
+void Range::set(int combo, double weight) {
+    weights_[combo] = static_cast<float>(weight);
+}
+
+void Range::set(CardSet holeCards, double weight) {
+    const int combo = comboIndex(holeCards);
+    if (combo < 0) throw std::invalid_argument("A holding is exactly two cards");
+    set(combo, weight);
+}
+
+void Range::clear() {
+    weights_.fill(0.0f);
+}
+
+int Range::size() const {
+    return static_cast<int>(std::count_if(weights_.begin(), weights_.end(), [](float w) { return w > 0.0f; }));
+}
+
+double Range::totalWeight() const {
+    double total = 0.0;
+    for (float w : weights_) total += w;
+    return total;
+}
@@ -0,0 +1,39 @@
+#ifndef RANGE_H
+#define RANGE_H
+
+#include <array>
+#include <string>
+#include "cardSet.h"
+
+// Weighted set of hole-card holdings: one weight in [0, 1] for each of the
+// 1326 two-card combos. Combo a < b (card indices) sits at b * (b - 1) / 2 + a.
+class Range {
+public:
+    static constexpr int NUM_COMBOS = 1326;
+
+    Range() = default; // Empty
+
+    // Parses PokerStove-style ranges, comma separated:
+    //   "QQ+"  "22-55"  "AKs"  "AKo"  "AK"  "A2s+"  "KTo+"  "76s-54s"  "A5s-A2s"  "AhKh"
+    // A ":weight" suffix applies a weight, e.g. "AKo:0.5". Throws std::invalid_argument.
+    static Range parse(const std::string& text);
+    static Range all();                    // Every combo at weight 1
+    static Range single(CardSet holeCards); // Exactly one combo
+
+    static int comboIndex(CardSet holeCards); // -1 unless exactly two cards
+    static CardSet comboCards(int index);
+
+    void set(int combo, double weight);
+    void set(CardSet holeCards, double weight);
+    double weight(int combo) const { return weights_[combo]; }
+    void clear();
+
+    int size() const; // Combos with nonzero weight
+    bool empty() const { return size() == 0; }
+    double totalWeight() const;
+
+private:
+    std::array<float, NUM_COMBOS> weights_{};
+};
+
+#endif // RANGE_H
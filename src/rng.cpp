@@ -0,0 +1,7 @@
+#include "rng.h"
+#include <random>
+
+uint64_t Rng::randomSeed() {
+    std::random_device rd;
+    return (static_cast<uint64_t>(rd()) << 32) ^ rd();
+}
@@ -0,0 +1,76 @@
+#ifndef RNG_H
+#define RNG_H
+
+#include <cstdint>
+#include <limits>
+
+// xoshiro256** generator. Small enough to live on each worker's stack, so
+// simulation threads never share RNG state. Satisfies UniformRandomBitGenerator.
+class Rng {
+public:
+    using result_type = uint64_t;
+
+    explicit Rng(uint64_t seed = 0) { reseed(seed); }
+
+    // Independent stream for one unit of work (e.g. a chunk of simulations).
+    // Depends only on the two inputs, never on which thread runs it.
+    static Rng forStream(uint64_t masterSeed, uint64_t streamIndex) {
+        uint64_t s = masterSeed;
+        uint64_t mixed = splitmix64(s) ^ (streamIndex * 0xD1B54A32D192ED03ull);
+        return Rng(mixed);
+    }
+
+    // Seed from std::random_device, for callers that want nondeterminism
+    static uint64_t randomSeed();
+
+    void reseed(uint64_t seed) {
+        uint64_t s = seed;
+        for (auto& word : state_) word = splitmix64(s);
+    }
+
+    uint64_t next() {
+        const uint64_t result = rotl(state_[1] * 5, 7) * 9;
+        const uint64_t t = state_[1] << 17;
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= t;
+        state_[3] = rotl(state_[3], 45);
+        return result;
+    }
+
+    // Uniform integer in [0, bound), unbiased (Lemire's multiply-shift with rejection)
+    uint32_t below(uint32_t bound) {
+        uint64_t m = (next() >> 32) * bound;
+        uint32_t low = static_cast<uint32_t>(m);
+        if (low < bound) {
+            const uint32_t threshold = (0u - bound) % bound;
+            while (low < threshold) {
+                m = (next() >> 32) * bound;
+                low = static_cast<uint32_t>(m);
+            }
+        }
+        return static_cast<uint32_t>(m >> 32);
+    }
+
+    double nextDouble() { return static_cast<double>(next() >> 11) * 0x1.0p-53; } // [0, 1)
+
+    result_type operator()() { return next(); }
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+private:
+    static uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+    static uint64_t splitmix64(uint64_t& s) {
+        uint64_t z = (s += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    uint64_t state_[4];
+};
+
+#endif // RNG_H
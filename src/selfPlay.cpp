@@ -0,0 +1,213 @@
+#include "selfPlay.h"
+#include "deck.h"
+#include "evaluator.h"
+#include "gameState.h"
+#include "handHistory.h"
+#include "metrics.h"
+#include "playerAI.h"
+#include "profiler.h"
+#include "threadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+constexpr uint64_t DEALS_PER_BLOCK = 64; // Unit of work and of the deal RNG streams
+
+Counter& handsPlayed = Metrics::counter("poker_hands_played_total", "Hands played to the end");
+
+struct Totals {
+    uint64_t deals = 0;
+    int64_t net = 0;           // players[0], summed over both hands of each deal
+    uint64_t netSquared = 0;   // Per-deal net squared, for the variance
+    uint64_t showdowns = 0;
+    uint64_t equityQueries = 0;
+
+    void add(const Totals& other) {
+        deals += other.deals;
+        net += other.net;
+        netSquared += other.netSquared;
+        showdowns += other.showdowns;
+        equityQueries += other.equityQueries;
+    }
+};
+
+// One hand between two seats; seat 0 acts first on every street
+class HandPlayer {
+public:
+    HandPlayer(playerAI& ai, const SelfPlayOptions& options, Rng& rng, Totals& totals)
+        : ai_(ai), options_(options), rng_(rng), totals_(totals) {}
+
+    // Forget the equities of the previous deal. Each deal seeds the equity
+    // engine from its own stream, so Monte Carlo noise is independent across
+    // deals yet the same on any thread count. ~seed keeps these streams apart
+    // from the per-block deck streams.
+    void newDeal(uint64_t deal) {
+        for (auto& seat : equity_) for (double& street : seat) street = -1.0;
+        handNumber_ = 2 * deal;
+        const uint64_t seed = Rng::forStream(~options_.seed, deal).next();
+        ai_.setSeed(seed ? seed : 1); // 0 would mean a random seed
+    }
+
+    // Returns seat 0's net chips. Seat i holds hole i in both hands of a deal.
+    int play(const AIConfig& config0, const AIConfig& config1,
+             const Hand& hole0, const Hand& hole1, const std::vector<Card>& board) {
+        configs_[0] = &config0;
+        configs_[1] = &config1;
+        holes_[0] = &hole0;
+        holes_[1] = &hole1;
+        GameState state = GameState::newHand(hole0, hole1, board, options_.startingStack,
+                                             options_.startingStack, options_.blind);
+        while (!state.isTerminal()) {
+            if (visible_.size() != static_cast<size_t>(state.boardCards()))
+                visible_.assign(board.begin(), board.begin() + state.boardCards());
+            state.apply(decide(state));
+        }
+        if (state.phase() == GameState::Phase::Showdown) ++totals_.showdowns;
+        if (options_.history) {
+            HandRecord record = HandRecord::fromState(state, options_.seed, handNumber_);
+            if (handNumber_ % 2) record.flags |= HandRecord::SWAPPED; // The deal's second hand
+            record.configs[0] = config0.id();
+            record.configs[1] = config1.id();
+            options_.history->append(record);
+        }
+        ++handNumber_;
+        handsPlayed.add();
+        return state.net(0);
+    }
+
+private:
+    // Equity only changes with the board, so each hole is evaluated once per street
+    double winChance(int seat, int street) {
+        double& cached = equity_[seat][street];
+        if (cached < 0.0) {
+            ++totals_.equityQueries;
+            cached = ai_.evaluateEquity(*holes_[seat], visible_, options_.equity).win;
+        }
+        return cached;
+    }
+
+    // AIPolicy's move; a raise past the betting cap becomes a call, a bet a check
+    Action decide(const GameState& state) {
+        const int seat = state.toAct();
+        const AIConfig& config = *configs_[seat];
+        const double win = winChance(seat, state.street());
+        const int toCall = state.toCall();
+
+        Action action;
+        if (toCall == 0) {
+            action = AIPolicy::respondToCheck(config, win, state.stack(seat), state.pot());
+            if (!state.isLegal(action)) action = Action{Action::Type::Check, 0};
+        } else {
+            action = AIPolicy::respondToBet(config, win, toCall, state.stack(seat), state.streetBet(1 - seat),
+                                            state.pot(), state.boardCards(), rng_);
+            if (!state.isLegal(action)) action = Action{Action::Type::Call, std::min(toCall, state.stack(seat))};
+        }
+        return action;
+    }
+
+    playerAI& ai_;
+    const SelfPlayOptions& options_;
+    Rng& rng_;
+    Totals& totals_;
+
+    const AIConfig* configs_[2] = {};
+    const Hand* holes_[2] = {};
+    std::vector<Card> visible_;
+    double equity_[2][4] = {}; // Per hole and street, -1 until evaluated
+    uint64_t handNumber_ = 0;  // Both hands of deal d are 2d and 2d + 1
+};
+
+// Both hands of one deal; returns players[0]'s net over the pair
+int64_t playDeal(HandPlayer& player, const SelfPlayOptions& options, Deck& deck, uint64_t deal) {
+    PROFILE_SCOPE("selfplay/deal");
+    player.newDeal(deal);
+    int dealt[9];
+    deck.dealExcluding(CardSet(), 9, dealt);
+    Hand holes[2];
+    for (int i = 0; i < 2; ++i) {
+        holes[0].addCard(Card::fromIndex(dealt[2 * i]));
+        holes[1].addCard(Card::fromIndex(dealt[2 * i + 1]));
+    }
+    std::vector<Card> board;
+    for (int i = 4; i < 9; ++i) board.push_back(Card::fromIndex(dealt[i]));
+
+    const AIConfig& a = options.players[0];
+    const AIConfig& b = options.players[1];
+    const int first = player.play(a, b, holes[0], holes[1], board);  // A in seat 0
+    const int second = player.play(b, a, holes[0], holes[1], board); // A takes seat 1 and its cards
+    return static_cast<int64_t>(first) - second;
+}
+
+} // namespace
+
+EquityOptions SelfPlayOptions::defaultEquityOptions() {
+    EquityOptions equity;
+    equity.maxSamples = 2000;
+    equity.batchSize = 2000;
+    return equity;
+}
+
+SelfPlayResult SelfPlay::run(const SelfPlayOptions& options) {
+    if (options.startingStack <= 0 || options.blind <= 0)
+        throw std::invalid_argument("Stacks and blinds must be positive");
+    Evaluator::init();
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto deadline = start + options.timeBudget;
+    const uint64_t numBlocks = (options.deals + DEALS_PER_BLOCK - 1) / DEALS_PER_BLOCK;
+
+    ThreadPool pool(ThreadPool::forCores(options.threads));
+    const unsigned workers = pool.maxCores();
+
+    std::atomic<uint64_t> nextBlock{0};
+    std::mutex totalsMutex;
+    Totals totals;
+
+    // One equity engine per worker, single-threaded: the hands are the parallelism
+    pool.parallelFor(workers, [&](size_t) {
+        ThreadPool enginePool(ThreadPool::forCores(1)); // No workers: the caller is the engine's only core
+        playerAI ai(enginePool);
+        ai.setExactThreshold(options.exactThreshold);
+        ai.setCacheBudget(0); // Cached isomorphic spots would make results depend on scheduling
+
+        Totals local;
+        for (uint64_t block = nextBlock++; block < numBlocks; block = nextBlock++) {
+            if (options.timeBudget.count() > 0 && std::chrono::steady_clock::now() >= deadline) break;
+            Rng rng = Rng::forStream(options.seed, block);
+            Deck deck(rng.next()); // Per block, so deals do not depend on which worker ran what
+            HandPlayer player(ai, options, rng, local);
+            const uint64_t end = std::min(options.deals, (block + 1) * DEALS_PER_BLOCK);
+            for (uint64_t deal = block * DEALS_PER_BLOCK; deal < end; ++deal) {
+                const int64_t net = playDeal(player, options, deck, deal);
+                ++local.deals;
+                local.net += net;
+                local.netSquared += static_cast<uint64_t>(net * net);
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(totalsMutex);
+        totals.add(local);
+    });
+
+    SelfPlayResult result;
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    result.hands = 2 * totals.deals;
+    result.netChips = totals.net;
+    result.showdowns = totals.showdowns;
+    result.equityQueries = totals.equityQueries;
+    if (totals.deals > 0) {
+        // Deals are the independent samples; each contributes two hands
+        const double n = static_cast<double>(totals.deals);
+        const double mean = totals.net / n;
+        const double variance = totals.deals > 1 ? (static_cast<double>(totals.netSquared) - n * mean * mean) / (n - 1) : 0.0;
+        const double perHundred = 100.0 / (2.0 * options.blind);
+        result.bbPer100 = mean * perHundred;
+        result.bbPer100Error = std::sqrt(std::max(variance, 0.0) / n) * perHundred;
+    }
+    return result;
+}
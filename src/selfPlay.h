@@ -0,0 +1,49 @@
+#ifndef SELFPLAY_H
+#define SELFPLAY_H
+
+#include <chrono>
+#include <cstdint>
+#include "aiPolicy.h"
+#include "equity.h"
+
+class HandHistoryWriter;
+
+// Headless heads-up matches between two AI configurations, for comparing
+// strategy changes. Every deal is played twice with seats and hole cards
+// swapped, so card luck and position cancel out of the win rate.
+// Hands follow GameState's rules; stacks are reset before each hand.
+struct SelfPlayOptions {
+    AIConfig players[2];                  // The win rate is reported for players[0]
+    uint64_t deals = 100000;              // Hands played = 2 * deals
+    uint64_t seed = 1;                    // Same seed and options give the same result on any thread count
+    unsigned threads = 0;                 // 0 = hardware_concurrency
+    std::chrono::seconds timeBudget{0};   // Stop dealing after this; 0 = play every deal
+    int startingStack = 2000;
+    int blind = 50;                       // Posted by both players; one big blind for bb/100
+    EquityOptions equity;                 // Per decision; see defaultEquityOptions()
+    uint64_t exactThreshold = 1000;       // Enumerate below this many showdowns (the river)
+    HandHistoryWriter* history = nullptr; // Every hand is appended when set, in completion order
+
+    SelfPlayOptions() : equity(defaultEquityOptions()) {}
+    static EquityOptions defaultEquityOptions(); // 2000 Monte Carlo samples per decision
+};
+
+struct SelfPlayResult {
+    uint64_t hands = 0;
+    int64_t netChips = 0;         // Won by players[0] over all hands
+    double bbPer100 = 0.0;        // players[0]'s win rate in big blinds per 100 hands
+    double bbPer100Error = 0.0;   // Standard error; +-1.96 of it is the 95% interval
+    uint64_t showdowns = 0;
+    uint64_t equityQueries = 0;   // One per hole card pair and street seen
+    double seconds = 0.0;
+
+    double handsPerSecond() const { return seconds > 0.0 ? hands / seconds : 0.0; }
+};
+
+class SelfPlay {
+public:
+    // Throws std::invalid_argument for non-positive stacks or blinds
+    static SelfPlayResult run(const SelfPlayOptions& options);
+};
+
+#endif // SELFPLAY_H
@@ -0,0 +1,144 @@
+#include "threadPool.h"
+#include <algorithm>
+#include <memory>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+ThreadPool::ThreadPool() : ThreadPool(Options()) {}
+
+ThreadPool::ThreadPool(const Options& options) : pinThreads_(options.pinThreads) {
+    unsigned numThreads = options.numThreads;
+    if (numThreads == 0) numThreads = std::thread::hardware_concurrency();
+    if (numThreads == 0) numThreads = 16; // fallback
+    if (numThreads == NO_WORKERS) numThreads = 0;
+    maxCores_ = options.maxCores;
+
+    workers_.reserve(numThreads);
+    for (unsigned i = 0; i < numThreads; ++i) {
+        workers_.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_) worker.join();
+}
+
+ThreadPool::Options ThreadPool::forCores(unsigned cores) {
+    if (cores == 0) cores = std::thread::hardware_concurrency();
+    if (cores == 0) cores = 16; // Same fallback as the constructor
+    Options options;
+    options.numThreads = cores > 1 ? cores - 1 : NO_WORKERS;
+    options.maxCores = cores;
+    return options;
+}
+
+ThreadPool& ThreadPool::shared() {
+    static ThreadPool pool;
+    return pool;
+}
+
+unsigned ThreadPool::size() const {
+    return static_cast<unsigned>(workers_.size());
+}
+
+unsigned ThreadPool::maxCores() const {
+    return maxCores_;
+}
+
+void ThreadPool::setMaxCores(unsigned cores) {
+    maxCores_ = cores;
+}
+
+void ThreadPool::parallelFor(size_t numChunks, const std::function<void(size_t)>& fn) {
+    if (numChunks == 0) return;
+
+    // Shared with the helpers by pointer: a helper that only gets scheduled
+    // after every chunk is done must still find the state alive
+    struct Job {
+        std::function<void(size_t)> fn;
+        size_t numChunks;
+        std::atomic<size_t> next{0};
+        std::atomic<size_t> done{0};
+        std::mutex mutex;
+        std::condition_variable finished;
+    };
+    auto job = std::make_shared<Job>();
+    job->fn = fn;
+    job->numChunks = numChunks;
+
+    auto runChunks = [](Job& j) {
+        size_t completed = 0;
+        for (size_t chunk = j.next++; chunk < j.numChunks; chunk = j.next++) {
+            j.fn(chunk);
+            ++completed;
+        }
+        if (completed && j.done.fetch_add(completed) + completed == j.numChunks) {
+            std::lock_guard<std::mutex> lock(j.mutex);
+            j.finished.notify_all();
+        }
+    };
+
+    unsigned cores = maxCores_ ? maxCores_.load() : size() + 1;
+    size_t helpers = std::min<size_t>({static_cast<size_t>(cores > 0 ? cores - 1 : 0),
+                                       static_cast<size_t>(size()), numChunks - 1});
+    for (size_t i = 0; i < helpers; ++i) {
+        submit([job, runChunks]() { runChunks(*job); });
+    }
+
+    // The caller works too, so a nested parallelFor from a worker cannot deadlock
+    runChunks(*job);
+    std::unique_lock<std::mutex> lock(job->mutex);
+    job->finished.wait(lock, [&]() { return job->done == job->numChunks; });
+}
+
+void ThreadPool::submit(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.push_back(std::move(task));
+    }
+    wake_.notify_one();
+}
+
+void ThreadPool::workerLoop(unsigned index) {
+    if (pinThreads_) pinCurrentThread(index);
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [&]() { return stopping_ || !tasks_.empty(); });
+            if (stopping_ && tasks_.empty()) return;
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+        task();
+    }
+}
+
+void ThreadPool::pinCurrentThread(unsigned core) {
+    unsigned cores = std::thread::hardware_concurrency();
+    if (cores == 0) return;
+    core %= cores;
+#ifdef _WIN32
+    if (core < sizeof(DWORD_PTR) * 8)
+        SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << core);
+#elif defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)core; // No portable affinity API (e.g. macOS); run unpinned
+#endif
+}
@@ -0,0 +1,63 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Long-lived worker threads. parallelFor() is the main entry point: the
+// calling thread and up to maxCores() - 1 workers pull chunk indices from a
+// shared counter until all chunks are done.
+class ThreadPool {
+public:
+    static constexpr unsigned NO_WORKERS = ~0u; // numThreads: the caller runs every chunk
+
+    struct Options {
+        unsigned numThreads = 0; // Workers to start; 0 = hardware_concurrency (16 if unknown)
+        unsigned maxCores = 0;   // Cores one parallelFor may occupy, caller included; 0 = all
+        bool pinThreads = false; // Pin worker i to core i (Linux and Windows only)
+    };
+
+    // A pool whose parallelFor runs on exactly `cores` cores, caller included,
+    // so it starts cores - 1 workers (none for 1); 0 = one per hardware thread
+    static Options forCores(unsigned cores);
+
+    ThreadPool();
+    explicit ThreadPool(const Options& options);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Process-wide pool with default options, started on first use
+    static ThreadPool& shared();
+
+    unsigned size() const;
+    unsigned maxCores() const;
+    void setMaxCores(unsigned cores); // 0 = no limit beyond size() + 1
+
+    // Runs fn(chunk) for every chunk in [0, numChunks) and returns when all have finished
+    void parallelFor(size_t numChunks, const std::function<void(size_t)>& fn);
+
+    // Queues a fire-and-forget task
+    void submit(std::function<void()> task);
+
+private:
+    void workerLoop(unsigned index);
+    static void pinCurrentThread(unsigned core);
+
+    std::vector<std::thread> workers_;
+    std::deque<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    bool stopping_ = false;
+    bool pinThreads_ = false;
+    std::atomic<unsigned> maxCores_{0};
+};
+
+#endif // THREADPOOL_H
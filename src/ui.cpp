@@ -1,5 +1,10 @@
 #include "ui.h"
+#include "profiler.h"
 #include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+#include <iterator>
 
 namespace ui {
 
@@ -10,49 +15,6 @@ constexpr float P1_HAND_Y      = 800.f;
 constexpr float P2_HAND_Y      = 200.f;
 constexpr float COMMUNITY_Y    = 500.f;
 
-// Internal helpers
-static void drawHand(const Hand& hand, sf::RenderWindow& window, float y, bool showCards) {
-    const auto& cards = hand.getCards();
-    for (size_t i = 0; i < cards.size(); ++i) {
-        float x = HAND_START_X + static_cast<float>(i) * CARD_X_SPACING;
-        Card card = cards[i];
-        card.setFaceUp(showCards);
-        card.draw(window, x, y);
-    }
-}
-
-static void drawCommunityCards(const std::vector<Card>& communityCards, size_t cardsToShow,
-                               sf::RenderWindow& window, unsigned int logicalWidth) {
-    // 110x (texture space) scaled later in Card::draw; spacing aligned with CARD_X_SPACING
-    float communityStartX = (static_cast<float>(logicalWidth) - (5.f * 110.f - 10.f)) / 2.0f;
-    for (size_t i = 0; i < communityCards.size(); ++i) {
-        float x = communityStartX + static_cast<float>(i) * CARD_X_SPACING;
-        Card card = communityCards[i];
-        card.setFaceUp(i < cardsToShow);
-        card.draw(window, x, COMMUNITY_Y);
-    }
-}
-
-static void drawStakes(int player1BetDisplay, int player2BetDisplay, int pendingStake,
-                       sf::RenderWindow& window, sf::Font& font,
-                       const std::string& player1Name, const std::string& player2Name,
-                       unsigned int logicalHeight) {
-    sf::Text p1BetText(player1Name + " Bet: " + std::to_string(player1BetDisplay), font, 20);
-    p1BetText.setFillColor(sf::Color::Yellow);
-    p1BetText.setPosition(50, static_cast<float>(logicalHeight) - 80.f);
-    window.draw(p1BetText);
-
-    sf::Text p2BetText(player2Name + " Bet: " + std::to_string(player2BetDisplay), font, 20);
-    p2BetText.setFillColor(sf::Color::Yellow);
-    p2BetText.setPosition(50, 40);
-    window.draw(p2BetText);
-
-    sf::Text pendingText("Your Bet: " + std::to_string(pendingStake), font, 30);
-    pendingText.setFillColor(sf::Color::White);
-    pendingText.setPosition(50, static_cast<float>(logicalHeight) - 140.f);
-    window.draw(pendingText);
-}
-
 // Public API
 Button createButton(const std::string& label,
                     sf::Font& font,
@@ -84,56 +46,163 @@ bool isButtonClicked(const Button& btn, sf::Vector2i mouse) {
     return btn.rect.getGlobalBounds().contains(static_cast<float>(mouse.x), static_cast<float>(mouse.y));
 }
 
-void drawGameElements(sf::RenderWindow& window, sf::Font& font,
-                      const Hand& player1Hand, const Hand& player2Hand,
-                      const std::vector<Card>& communityCards, size_t cardsToShow,
-                      int player1BetDisplay, int player2BetDisplay, int pendingStake, int pot,
-                      int player1score, int player2score,
-                      bool gameFinished, const std::string& winnerText,
-                      const std::vector<Button*>& activeButtons,
-                      double /*lastP2WinPercentage*/,
-                      const std::string& player1Name, const std::string& player2Name,
-                      unsigned int logicalWidth, unsigned int logicalHeight) {
-    // Hands
-    drawHand(player1Hand, window, P1_HAND_Y, true);
-    drawHand(player2Hand, window, P2_HAND_Y, gameFinished); // Show AI cards only after round ends
-
-    // Board
-    drawCommunityCards(communityCards, cardsToShow, window, logicalWidth);
-
-    // Stakes and pot
-    drawStakes(player1BetDisplay, player2BetDisplay, pendingStake, window, font, player1Name, player2Name, logicalHeight);
-
-    sf::Text potText("Pot: " + std::to_string(pot), font, 28);
-    potText.setFillColor(sf::Color::Cyan);
-    potText.setPosition(900, 400);
-    window.draw(potText);
-
-    // Scores
-    sf::Text scoreText1(player1Name + " Score: " + std::to_string(player1score), font, 20);
-    scoreText1.setFillColor(sf::Color::White);
-    scoreText1.setPosition(1500, 1000);
-    window.draw(scoreText1);
-
-    sf::Text scoreText2(player2Name + " Score: " + std::to_string(player2score), font, 20);
-    scoreText2.setFillColor(sf::Color::White);
-    scoreText2.setPosition(1500, 40);
-    window.draw(scoreText2);
+TableView::TableView(const sf::Font& font, const CardAtlas& cardAtlas,
+                     const std::string& player1Name, const std::string& player2Name,
+                     unsigned int logicalWidth, unsigned int logicalHeight)
+    : cardAtlas_(cardAtlas),
+      logicalWidth_(logicalWidth),
+      player1BetPrefix_(player1Name + " Bet: "),
+      player2BetPrefix_(player2Name + " Bet: "),
+      player1ScorePrefix_(player1Name + " Score: "),
+      player2ScorePrefix_(player2Name + " Score: "),
+      cardVertices_(sf::Triangles),
+      shownPlayer1Bet_(INT_MIN), shownPlayer2Bet_(INT_MIN), shownPendingStake_(INT_MIN),
+      shownPot_(INT_MIN), shownPlayer1Score_(INT_MIN), shownPlayer2Score_(INT_MIN) {
+    std::fill(std::begin(cards_), std::end(cards_), NO_CARD);
+
+    auto setup = [&](sf::Text& text, unsigned int size, sf::Color color, float x, float y) {
+        text.setFont(font);
+        text.setCharacterSize(size);
+        text.setFillColor(color);
+        text.setPosition(x, y);
+    };
+    const float height = static_cast<float>(logicalHeight);
+    setup(player1Bet_, 20, sf::Color::Yellow, 50, height - 80.f);
+    setup(player2Bet_, 20, sf::Color::Yellow, 50, 40);
+    setup(pendingStake_, 30, sf::Color::White, 50, height - 140.f);
+    setup(pot_, 28, sf::Color::Cyan, 900, 400);
+    setup(player1Score_, 20, sf::Color::White, 1500, 1000);
+    setup(player2Score_, 20, sf::Color::White, 1500, 40);
+    setup(winner_, 36, sf::Color::White, static_cast<float>(logicalWidth) / 2.0f, height / 2.0f + 200.f);
+    setup(thinking_, 24, sf::Color::Yellow, HAND_START_X, P2_HAND_Y - 50.f);
+    thinking_.setString(player2Name + " is thinking...");
+}
+
+bool TableView::setNumber(sf::Text& text, const std::string& prefix, int value, int& shown) {
+    if (value == shown) return false;
+    text.setString(prefix + std::to_string(value));
+    shown = value;
+    return true;
+}
+
+void TableView::rebuildCards() {
+    cardVertices_.clear();
+    // Five cards 110 apart minus the last gap; spacing aligned with CARD_X_SPACING
+    const float communityStartX = (static_cast<float>(logicalWidth_) - (5.f * 110.f - 10.f)) / 2.0f;
+    for (int slot = 0; slot < CARD_SLOTS; ++slot) {
+        if (cards_[slot] == NO_CARD) continue;
+        sf::Vector2f position;
+        if (slot < 4) {
+            position.x = HAND_START_X + static_cast<float>(slot % 2) * CARD_X_SPACING;
+            position.y = slot < 2 ? P1_HAND_Y : P2_HAND_Y;
+        } else {
+            position.x = communityStartX + static_cast<float>(slot - 4) * CARD_X_SPACING;
+            position.y = COMMUNITY_Y;
+        }
+        cardAtlas_.appendCard(cardVertices_, cards_[slot], position);
+    }
+}
+
+bool TableView::update(const Hand& player1Hand, const Hand& player2Hand,
+                       const std::vector<Card>& communityCards, size_t cardsToShow,
+                       int player1BetDisplay, int player2BetDisplay, int pendingStake, int pot,
+                       int player1score, int player2score,
+                       bool gameFinished, const std::string& winnerText, bool aiThinking,
+                       const std::vector<Button*>& activeButtons) {
+    PROFILE_SCOPE("ui/tableUpdate");
+    bool changed = firstUpdate_;
+    firstUpdate_ = false;
+
+    // Cards: what each slot shows, compared before touching any vertex
+    int cards[CARD_SLOTS];
+    std::fill(std::begin(cards), std::end(cards), NO_CARD);
+    auto fillHand = [&](const Hand& hand, int firstSlot, bool showCards) {
+        const auto& held = hand.getCards();
+        for (size_t i = 0; i < held.size() && i < 2; ++i)
+            cards[firstSlot + i] = showCards ? held[i].getIndex() : CardAtlas::BACK;
+    };
+    fillHand(player1Hand, 0, true);
+    fillHand(player2Hand, 2, gameFinished); // Show AI cards only after round ends
+    for (size_t i = 0; i < communityCards.size() && i < 5; ++i)
+        cards[4 + i] = i < cardsToShow ? communityCards[i].getIndex() : CardAtlas::BACK;
+    if (!std::equal(std::begin(cards), std::end(cards), std::begin(cards_))) {
+        std::copy(std::begin(cards), std::end(cards), std::begin(cards_));
+        rebuildCards();
+        changed = true;
+    }
+
+    // Stakes, pot and scores
+    changed |= setNumber(player1Bet_, player1BetPrefix_, player1BetDisplay, shownPlayer1Bet_);
+    changed |= setNumber(player2Bet_, player2BetPrefix_, player2BetDisplay, shownPlayer2Bet_);
+    changed |= setNumber(pendingStake_, "Your Bet: ", pendingStake, shownPendingStake_);
+    changed |= setNumber(pot_, "Pot: ", pot, shownPot_);
+    changed |= setNumber(player1Score_, player1ScorePrefix_, player1score, shownPlayer1Score_);
+    changed |= setNumber(player2Score_, player2ScorePrefix_, player2score, shownPlayer2Score_);
 
     // Round winner
-    if (gameFinished) {
-        sf::Text winAnnounceText(winnerText, font, 36);
-        winAnnounceText.setFillColor(sf::Color::White);
-        sf::FloatRect textRect = winAnnounceText.getLocalBounds();
-        winAnnounceText.setOrigin(textRect.left + textRect.width / 2.0f, textRect.top + textRect.height / 2.0f);
-        winAnnounceText.setPosition(static_cast<float>(logicalWidth) / 2.0f, static_cast<float>(logicalHeight) / 2.0f + 200.f);
-        window.draw(winAnnounceText);
+    if (gameFinished != showWinner_) {
+        showWinner_ = gameFinished;
+        changed = true;
+    }
+    if (winnerText != shownWinnerText_) {
+        shownWinnerText_ = winnerText;
+        winner_.setString(winnerText);
+        sf::FloatRect textRect = winner_.getLocalBounds();
+        winner_.setOrigin(textRect.left + textRect.width / 2.0f, textRect.top + textRect.height / 2.0f);
+        changed |= showWinner_;
+    }
+
+    // AI decision still running in the background
+    if (aiThinking != showThinking_) {
+        showThinking_ = aiThinking;
+        changed = true;
+    }
+
+    if (!std::equal(activeButtons.begin(), activeButtons.end(), buttons_.begin(), buttons_.end())) {
+        buttons_.assign(activeButtons.begin(), activeButtons.end());
+        changed = true;
     }
+    return changed;
+}
 
-    // Active buttons
-    for (const auto* btnPtr : activeButtons) {
+void TableView::draw(sf::RenderWindow& window) const {
+    PROFILE_SCOPE("ui/tableDraw");
+    // Hands and board: one vertex array, one draw call
+    window.draw(cardVertices_, sf::RenderStates(cardAtlas_.texture()));
+
+    window.draw(player1Bet_);
+    window.draw(player2Bet_);
+    window.draw(pendingStake_);
+    window.draw(pot_);
+    window.draw(player1Score_);
+    window.draw(player2Score_);
+    if (showWinner_) window.draw(winner_);
+    if (showThinking_) window.draw(thinking_);
+
+    for (const auto* btnPtr : buttons_) {
         if (btnPtr) drawButton(window, *btnPtr);
     }
 }
 
-} // namespace ui
\ No newline at end of file
+ProfilerOverlay::ProfilerOverlay(const sf::Font& font) {
+    text_.setFont(font);
+    text_.setCharacterSize(18);
+    text_.setFillColor(sf::Color::White);
+    text_.setOutlineColor(sf::Color::Black);
+    text_.setOutlineThickness(1.f);
+    text_.setPosition(10, 10);
+}
+
+void ProfilerOverlay::setStats(double frameMs, double aiDecisionMs, double simulationsPerSecond) {
+    if (!visible_) return;
+    char line[160];
+    std::snprintf(line, sizeof(line), "frame %.2f ms   AI decision %.0f ms   %.2fM sims/s   F4: save trace",
+                  frameMs, aiDecisionMs, simulationsPerSecond / 1e6);
+    text_.setString(line);
+}
+
+void ProfilerOverlay::draw(sf::RenderWindow& window) const {
+    if (visible_) window.draw(text_);
+}
+
+} // namespace ui
@@ -5,6 +5,7 @@
 #include <vector>
 #include "hand.h"
 #include "card.h"
+#include "cardAtlas.h"
 
 namespace ui {
 
@@ -27,16 +28,70 @@ void drawButton(sf::RenderWindow& window, const Button& btn);
 
 bool isButtonClicked(const Button& btn, sf::Vector2i mouse);
 
-// Rendering entrypoint: draws all game elements
-void drawGameElements(sf::RenderWindow& window, sf::Font& font,
-                      const Hand& player1Hand, const Hand& player2Hand,
-                      const std::vector<Card>& communityCards, size_t cardsToShow,
-                      int player1BetDisplay, int player2BetDisplay, int pendingStake, int pot,
-                      int player1score, int player2score,
-                      bool gameFinished, const std::string& winnerText,
-                      const std::vector<Button*>& activeButtons,
-                      double lastP2WinPercentage,
-                      const std::string& player1Name, const std::string& player2Name,
-                      unsigned int logicalWidth, unsigned int logicalHeight);
-
-} // namespace ui
\ No newline at end of file
+// Retained table: keeps every drawable between frames and rebuilds one only
+// when the value behind it changes, so an unchanged table costs no string
+// formatting and the caller can skip the frame entirely.
+// Hold'em layout: two hole cards per player and up to five board cards.
+class TableView {
+public:
+    TableView(const sf::Font& font, const CardAtlas& cardAtlas,
+              const std::string& player1Name, const std::string& player2Name,
+              unsigned int logicalWidth, unsigned int logicalHeight);
+
+    // True if anything visible changed since the last call
+    bool update(const Hand& player1Hand, const Hand& player2Hand,
+                const std::vector<Card>& communityCards, size_t cardsToShow,
+                int player1BetDisplay, int player2BetDisplay, int pendingStake, int pot,
+                int player1score, int player2score,
+                bool gameFinished, const std::string& winnerText, bool aiThinking,
+                const std::vector<Button*>& activeButtons);
+
+    void draw(sf::RenderWindow& window) const;
+
+private:
+    static constexpr int CARD_SLOTS = 9; // Player 1, player 2, board
+    static constexpr int NO_CARD = -2;   // Empty slot; CardAtlas::BACK is face down
+
+    bool setNumber(sf::Text& text, const std::string& prefix, int value, int& shown);
+    void rebuildCards();
+
+    const CardAtlas& cardAtlas_;
+    unsigned int logicalWidth_;
+    std::string player1BetPrefix_, player2BetPrefix_, player1ScorePrefix_, player2ScorePrefix_;
+
+    int cards_[CARD_SLOTS];
+    sf::VertexArray cardVertices_;
+
+    sf::Text player1Bet_, player2Bet_, pendingStake_, pot_, player1Score_, player2Score_;
+    int shownPlayer1Bet_, shownPlayer2Bet_, shownPendingStake_, shownPot_, shownPlayer1Score_, shownPlayer2Score_;
+
+    sf::Text winner_;
+    std::string shownWinnerText_;
+    bool showWinner_ = false;
+
+    sf::Text thinking_;
+    bool showThinking_ = false;
+
+    std::vector<const Button*> buttons_;
+    bool firstUpdate_ = true;
+};
+
+// Frame time, AI decision latency and simulation rate in the top-left corner
+class ProfilerOverlay {
+public:
+    explicit ProfilerOverlay(const sf::Font& font);
+
+    void setVisible(bool visible) { visible_ = visible; }
+    bool isVisible() const { return visible_; }
+
+    // Call only for frames that get drawn anyway: new numbers alone do not need a frame
+    void setStats(double frameMs, double aiDecisionMs, double simulationsPerSecond);
+
+    void draw(sf::RenderWindow& window) const;
+
+private:
+    sf::Text text_;
+    bool visible_ = false;
+};
+
+} // namespace ui
@@ -0,0 +1,97 @@
+// Reads a hand-history log and reports, per seat and per player, the chips
+// actually won next to the all-in EV result, i.e. with card luck after an
+// all-in taken out. --streets adds the street EV win rate, which prices the
+// chips matched on each street at the equity after that street's last action
+// and takes far longer. Player A is
+// seat 0 unless a self-play record swapped seats, so A and B are
+// poker_selfplay's --a and --b, or the human and the AI in a game log.
+// Players are reported per pair of configurations (AIConfig::id(), as printed by
+// poker_selfplay), so runs with different settings appended to one log stay apart.
+//
+// Usage: poker_analyze [--threads T] [--samples N] [--seed S] [--streets] FILE
+// --samples sets the Monte Carlo runouts per preflop all-in matchup (default 20000).
+#include "handAnalysis.h"
+#include "handHistory.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+namespace {
+
+void printRow(const char* name, const PlayerResult& result, bool streetEv) {
+    std::cout << std::setw(8) << std::left << name << std::right
+              << std::setw(12) << result.hands
+              << std::setw(10) << result.allIns
+              << std::setw(14) << result.net
+              << std::setw(14) << std::setprecision(0) << result.evNet
+              << std::setw(12) << std::setprecision(2) << result.bbPer100()
+              << std::setw(12) << result.evBbPer100();
+    if (streetEv) std::cout << std::setw(15) << result.streetEvBbPer100();
+    std::cout << std::setw(12) << result.bbPer100() - result.evBbPer100() << "\n";
+}
+
+std::string configName(uint32_t id) {
+    if (id == HandRecord::HUMAN) return "human";
+    std::ostringstream name;
+    name << "config " << std::hex << std::setw(8) << std::setfill('0') << id;
+    return name.str();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    HandAnalysisOptions options;
+    std::string path;
+    for (int i = 1; i < argc; ++i) {
+        const bool hasValue = i + 1 < argc;
+        if (!std::strcmp(argv[i], "--threads") && hasValue) options.threads = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        else if (!std::strcmp(argv[i], "--samples") && hasValue) options.preflopSamples = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        else if (!std::strcmp(argv[i], "--seed") && hasValue) options.seed = std::strtoull(argv[++i], nullptr, 10);
+        else if (!std::strcmp(argv[i], "--streets")) options.streetEv = true;
+        else if (argv[i][0] != '-' && path.empty()) path = argv[i];
+        else {
+            path.clear();
+            break;
+        }
+    }
+    if (path.empty()) {
+        std::cerr << "Usage: " << argv[0] << " [--threads T] [--samples N] [--seed S] [--streets] FILE" << std::endl;
+        return 1;
+    }
+
+    try {
+        const HandHistoryReader history(path);
+        const HandAnalysisResult result = HandAnalysis::run(history, options);
+
+        const double hands = static_cast<double>(std::max<uint64_t>(result.hands, 1));
+        std::cout << std::fixed << std::setprecision(2)
+                  << "hands:     " << result.hands << "\n"
+                  << "showdowns: " << 100.0 * result.showdowns / hands << "%, all-in before the river "
+                  << 100.0 * result.allIns / hands << "%\n";
+        if (result.truncated)
+            std::cout << "truncated: " << result.truncated << " hands with missing actions, counted as played\n";
+        std::cout << "time:      " << result.seconds << " s, " << std::setprecision(0)
+                  << result.handsPerSecond() << " hands/s\n\n"
+                  << std::setw(8) << std::left << "" << std::right
+                  << std::setw(12) << "hands" << std::setw(10) << "all-ins"
+                  << std::setw(14) << "net" << std::setw(14) << "EV net"
+                  << std::setw(12) << "bb/100" << std::setw(12) << "EV bb/100";
+        if (options.streetEv) std::cout << std::setw(15) << "street EV/100";
+        std::cout << std::setw(12) << "luck" << "\n";
+        printRow("seat 0", result.seats[0], options.streetEv);
+        printRow("seat 1", result.seats[1], options.streetEv);
+        for (const MatchupResult& matchup : result.matchups) {
+            std::cout << "A: " << configName(matchup.configs[0]) << ", B: " << configName(matchup.configs[1]) << "\n";
+            printRow("A", matchup.players[0], options.streetEv);
+            printRow("B", matchup.players[1], options.streetEv);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
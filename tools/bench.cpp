@@ -0,0 +1,339 @@
+// Microbenchmarks for the engine's hot paths, in the spirit of Google Benchmark:
+// each case runs with growing iteration counts until it lasts --min-time, then
+// reports ns/op, items/s (hands evaluated or samples simulated) and heap
+// allocations per op. --json writes the results in Google Benchmark's JSON
+// layout; --compare BASE.json runs and prints the change against an earlier run.
+//
+// Usage: poker_bench [--filter SUBSTRING] [--min-time SECONDS] [--threads N]
+//                    [--json PATH] [--compare BASE.json]
+#include "card.h"
+#include "cardSet.h"
+#include "comparer.h"
+#include "deck.h"
+#include "evaluator.h"
+#include "hand.h"
+#include "playerAI.h"
+#include "rng.h"
+#include "threadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Every allocation in the process goes through these, so a benchmark's
+// allocs/op is the counter's growth over its timed run divided by iterations
+static std::atomic<uint64_t> allocationCount{0};
+
+void* operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t size) { return operator new(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size ? size : 1);
+}
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept { return operator new(size, tag); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+// Keeps the compiler from discarding a benchmark's result
+template <typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* sink;
+    sink = &value;
+#endif
+}
+
+struct Benchmark {
+    std::string name;
+    double itemsPerOp;                                // Hands or samples per call, for items/s
+    std::function<void(uint64_t iterations)> run;     // Runs the operation `iterations` times
+};
+
+struct Result {
+    std::string name;
+    uint64_t iterations = 0;
+    double realNs = 0.0;   // Wall time per op
+    double cpuNs = 0.0;    // Process CPU time per op, all threads
+    double itemsPerSecond = 0.0;
+    double allocsPerOp = 0.0;
+};
+
+Result measure(const Benchmark& benchmark, double minTime) {
+    benchmark.run(1); // Warm-up: tables, caches, lazily started threads
+
+    Result result;
+    result.name = benchmark.name;
+    for (uint64_t iterations = 1;; ) {
+        const uint64_t allocsBefore = allocationCount.load();
+        const std::clock_t cpuStart = std::clock();
+        const auto start = std::chrono::steady_clock::now();
+        benchmark.run(iterations);
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        const double cpuSeconds = static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+        const uint64_t allocs = allocationCount.load() - allocsBefore;
+
+        if (seconds >= minTime || iterations >= (uint64_t(1) << 40)) {
+            result.iterations = iterations;
+            result.realNs = seconds * 1e9 / iterations;
+            result.cpuNs = cpuSeconds * 1e9 / iterations;
+            result.itemsPerSecond = seconds > 0.0 ? benchmark.itemsPerOp * iterations / seconds : 0.0;
+            result.allocsPerOp = static_cast<double>(allocs) / iterations;
+            return result;
+        }
+        // Aim 40% past the target so the next round usually finishes it
+        const double scale = seconds > 0.0 ? minTime * 1.4 / seconds : 10.0;
+        iterations = std::max(iterations + 1, static_cast<uint64_t>(iterations * std::min(scale, 10.0)));
+    }
+}
+
+// Equity engine on a private pool of `threads` cores, caller included
+struct Engine {
+    explicit Engine(unsigned threads) : pool(ThreadPool::forCores(threads)), ai(pool) {
+        ai.setSeed(1);
+        ai.setCacheBudget(0); // Every call simulates
+    }
+
+    ThreadPool pool;
+    playerAI ai;
+};
+
+std::vector<Hand> randomHands(int numHands, int cardsPerHand, uint64_t seed) {
+    Deck deck(seed);
+    std::vector<Hand> hands(numHands);
+    for (Hand& hand : hands) {
+        deck.reset();
+        for (int i = 0; i < cardsPerHand; ++i) hand.addCard(deck.draw());
+    }
+    return hands;
+}
+
+std::vector<Benchmark> makeBenchmarks(unsigned maxThreads) {
+    constexpr int POOL = 1024; // Inputs cycled through, so no branch learns one hand
+    auto sevenCards = std::make_shared<std::vector<Hand>>(randomHands(POOL, 7, 1));
+    auto sevenCardSets = std::make_shared<std::vector<CardSet>>();
+    for (const Hand& hand : *sevenCards) sevenCardSets->push_back(hand.getCardSet());
+
+    std::vector<Benchmark> benchmarks;
+    benchmarks.push_back({"Comparer/getHandType", 1.0, [sevenCards](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) doNotOptimize(Comparer::getHandType((*sevenCards)[i % POOL]));
+    }});
+    benchmarks.push_back({"Comparer/compareHands/Hand", 2.0, [sevenCards](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i)
+            doNotOptimize(Comparer::compareHands((*sevenCards)[i % POOL], (*sevenCards)[(i + 1) % POOL]));
+    }});
+    benchmarks.push_back({"Comparer/compareHands/CardSet", 2.0, [sevenCardSets](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i)
+            doNotOptimize(Comparer::compareHands((*sevenCardSets)[i % POOL], (*sevenCardSets)[(i + 1) % POOL]));
+    }});
+
+    constexpr int SEATS = 6;
+    benchmarks.push_back({"Comparer/getWinners/Hand/6", SEATS, [sevenCards](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i)
+            doNotOptimize(Comparer::getWinners(&(*sevenCards)[(i * SEATS) % (POOL - SEATS)], SEATS));
+    }});
+    benchmarks.push_back({"Comparer/getWinners/CardSet/6", SEATS, [sevenCardSets](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i)
+            doNotOptimize(Comparer::getWinners(&(*sevenCardSets)[(i * SEATS) % (POOL - SEATS)], SEATS));
+    }});
+
+    // Flop spot for the simulation benchmarks
+    auto hero = std::make_shared<Hand>(CardSet::fromPokerStoveString("AhKd").toHand());
+    auto flop = std::make_shared<std::vector<Card>>(CardSet::fromPokerStoveString("Qh7s2c").toCards());
+
+    auto ai = std::make_shared<playerAI>();
+    benchmarks.push_back({"playerAI/simulateWin/Hand", 1.0, [ai, hero, flop](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) doNotOptimize(ai->simulateWin(*hero, *flop));
+    }});
+    benchmarks.push_back({"playerAI/simulateWin/CardSet", 1.0, [ai, hero, flop](uint64_t n) {
+        Rng rng(1);
+        const CardSet hand(*hero), board(*flop);
+        for (uint64_t i = 0; i < n; ++i) doNotOptimize(ai->simulateWin(hand, board, rng));
+    }});
+
+    std::vector<unsigned> threadCounts;
+    for (unsigned t = 1; t < maxThreads; t *= 2) threadCounts.push_back(t);
+    threadCounts.push_back(maxThreads);
+    const EquityOptions equity; // Default fixed sample count
+    for (unsigned threads : threadCounts) {
+        // Pool and engine are built on the warm-up call, outside the timed runs
+        auto engine = std::make_shared<std::unique_ptr<Engine>>();
+        benchmarks.push_back({"playerAI/evaluateHand/threads:" + std::to_string(threads),
+                              static_cast<double>(equity.maxSamples), [engine, hero, flop, threads](uint64_t n) {
+            if (!*engine) *engine = std::make_unique<Engine>(threads);
+            for (uint64_t i = 0; i < n; ++i) doNotOptimize((*engine)->ai.evaluateHand(*hero, *flop));
+        }});
+    }
+
+    benchmarks.push_back({"Deck/reset", 1.0, [](uint64_t n) {
+        Deck deck(1);
+        for (uint64_t i = 0; i < n; ++i) {
+            deck.reset();
+            doNotOptimize(deck);
+        }
+    }});
+    benchmarks.push_back({"Deck/shuffle", 1.0, [](uint64_t n) {
+        Deck deck(1);
+        for (uint64_t i = 0; i < n; ++i) {
+            deck.shuffle();
+            doNotOptimize(deck);
+        }
+    }});
+    benchmarks.push_back({"Deck/draw", 1.0, [](uint64_t n) {
+        Deck deck(1);
+        for (uint64_t i = 0; i < n; ++i) {
+            if (deck.isEmpty()) deck.shuffle(); // Once per 52 draws
+            doNotOptimize(deck.draw());
+        }
+    }});
+
+    benchmarks.push_back({"Deck/dealExcluding/9", 9.0, [](uint64_t n) {
+        Deck deck(1);
+        int dealt[9];
+        for (uint64_t i = 0; i < n; ++i) {
+            deck.dealExcluding(CardSet(), 9, dealt);
+            doNotOptimize(dealt);
+        }
+    }});
+    benchmarks.push_back({"Deck/dealExcluding/runout", 5.0, [](uint64_t n) {
+        Deck deck(1);
+        Rng rng(1);
+        const CardSet dead = CardSet::fromPokerStoveString("AhKdQh7s");
+        for (uint64_t i = 0; i < n; ++i) doNotOptimize(deck.dealExcluding(dead, 5, rng));
+    }});
+
+    auto holes = std::make_shared<std::vector<Hand>>(randomHands(POOL, 2, 2));
+    auto boards = std::make_shared<std::vector<Hand>>(randomHands(POOL, 5, 3));
+    benchmarks.push_back({"Hand/combineHands", 1.0, [holes, boards](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) doNotOptimize((*holes)[i % POOL].combineHands((*boards)[i % POOL]));
+    }});
+    return benchmarks;
+}
+
+std::string jsonEscape(const std::string& text) {
+    std::string escaped;
+    for (char c : text) {
+        if (c == '"' || c == '\\') escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+// Google Benchmark's JSON layout, one benchmark object per line
+void writeJson(std::ostream& out, const std::vector<Result>& results, unsigned maxThreads) {
+    char date[64];
+    const std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof date, "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+    out << "{\n  \"context\": {\"date\": \"" << date << "\", \"num_cpus\": " << std::thread::hardware_concurrency()
+        << ", \"max_threads\": " << maxThreads
+        << ", \"simd\": \"" << Evaluator::simdLevelName(Evaluator::simdLevel()) << "\"},\n"
+        << "  \"benchmarks\": [\n";
+    char line[512];
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        std::snprintf(line, sizeof line,
+                      "    {\"name\": \"%s\", \"iterations\": %llu, \"real_time\": %.3f, \"cpu_time\": %.3f, "
+                      "\"time_unit\": \"ns\", \"items_per_second\": %.1f, \"allocs_per_op\": %.3f}%s\n",
+                      jsonEscape(r.name).c_str(), static_cast<unsigned long long>(r.iterations), r.realNs,
+                      r.cpuNs, r.itemsPerSecond, r.allocsPerOp, i + 1 < results.size() ? "," : "");
+        out << line;
+    }
+    out << "  ]\n}\n";
+}
+
+// Reads name -> real_time back from a file written by writeJson
+std::map<std::string, double> readJson(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) throw std::runtime_error("Cannot open " + path);
+    std::map<std::string, double> times;
+    std::string line;
+    while (std::getline(in, line)) {
+        const size_t name = line.find("\"name\": \"");
+        const size_t time = line.find("\"real_time\": ");
+        if (name == std::string::npos || time == std::string::npos) continue;
+        const size_t nameStart = name + 9;
+        const size_t nameEnd = line.find('"', nameStart);
+        times[line.substr(nameStart, nameEnd - nameStart)] = std::strtod(line.c_str() + time + 13, nullptr);
+    }
+    return times;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string filter, jsonPath, comparePath;
+    double minTime = 0.5;
+    unsigned maxThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    for (int i = 1; i < argc; ++i) {
+        const bool hasValue = i + 1 < argc;
+        if (!std::strcmp(argv[i], "--filter") && hasValue) filter = argv[++i];
+        else if (!std::strcmp(argv[i], "--min-time") && hasValue) minTime = std::strtod(argv[++i], nullptr);
+        else if (!std::strcmp(argv[i], "--threads") && hasValue) maxThreads = std::max(1ul, std::strtoul(argv[++i], nullptr, 10));
+        else if (!std::strcmp(argv[i], "--json") && hasValue) jsonPath = argv[++i];
+        else if (!std::strcmp(argv[i], "--compare") && hasValue) comparePath = argv[++i];
+        else {
+            std::cerr << "Usage: " << argv[0] << " [--filter SUBSTRING] [--min-time SECONDS] [--threads N]"
+                      << " [--json PATH] [--compare BASE.json]" << std::endl;
+            return 1;
+        }
+    }
+
+    try {
+        std::map<std::string, double> baseline;
+        if (!comparePath.empty()) baseline = readJson(comparePath);
+
+        Evaluator::init();
+        std::printf("SIMD: %s, %u threads max, min time %.2f s\n",
+                    Evaluator::simdLevelName(Evaluator::simdLevel()), maxThreads, minTime);
+        std::printf("%-36s %14s %12s %16s %10s%s\n", "Benchmark", "Time/op", "Iterations", "Items/s",
+                    "Allocs/op", baseline.empty() ? "" : "   vs base");
+
+        std::vector<Result> results;
+        for (const Benchmark& benchmark : makeBenchmarks(maxThreads)) {
+            if (!filter.empty() && benchmark.name.find(filter) == std::string::npos) continue;
+            const Result r = measure(benchmark, minTime);
+            results.push_back(r);
+
+            std::printf("%-36s %11.1f ns %12llu %16.0f %10.2f", r.name.c_str(), r.realNs,
+                        static_cast<unsigned long long>(r.iterations), r.itemsPerSecond, r.allocsPerOp);
+            const auto base = baseline.find(r.name);
+            if (base != baseline.end() && base->second > 0.0)
+                std::printf("   %+7.1f%%", (r.realNs / base->second - 1.0) * 100.0); // + is slower
+            std::printf("\n");
+            std::fflush(stdout);
+        }
+
+        if (!jsonPath.empty()) {
+            std::ofstream out(jsonPath);
+            if (!out) throw std::runtime_error("Cannot write " + jsonPath);
+            writeJson(out, results, maxThreads);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,153 @@
+// Checks of the headless core's pure logic: Deck::dealExcluding determinism
+// and dead-card handling, GameState apply/undo and payouts, and the seats and
+// streets HandRecord::fromState rebuilds. Prints each failed check and exits
+// with status 1 if there was any.
+//
+// Usage: poker_corecheck
+#include "cardSet.h"
+#include "deck.h"
+#include "gameState.h"
+#include "handHistory.h"
+#include "rng.h"
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+int failures = 0;
+
+void check(bool ok, const std::string& what) {
+    if (!ok) {
+        ++failures;
+        std::cout << "  FAILED: " << what << "\n";
+    }
+}
+
+void checkDeck() {
+    // Equal Rng state deals equal cards, whatever the deck dealt before
+    Deck fresh(1), used(2);
+    Rng other(99);
+    int scrap[9];
+    used.dealExcluding(CardSet::fromPokerStoveString("AsKs"), 9, scrap, other);
+    used.dealExcluding(CardSet(), 5);
+    for (uint64_t seed = 0; seed < 100; ++seed) {
+        Rng cards = Rng::forStream(seed, 0);
+        const CardSet dead(cards.next() & cards.next() & CardSet::FULL_MASK); // About 13 cards
+        Rng a(seed), b(seed);
+        int first[9], second[9];
+        fresh.dealExcluding(dead, 9, first, a);
+        used.dealExcluding(CardSet(cards.next() & CardSet::FULL_MASK), 3, scrap, other); // Intervening deal
+        used.dealExcluding(dead, 9, second, b);
+        bool same = true;
+        for (int i = 0; i < 9; ++i) same &= first[i] == second[i];
+        check(same, "dealExcluding with equal Rng state, seed " + std::to_string(seed));
+    }
+
+    // Every card live and distinct, down to the last live card of the deck
+    Rng rng(7);
+    for (int k = 52; k > 0; --k) {
+        const CardSet dead = CardSet((uint64_t(1) << k) - 1).complement();
+        int cards[52];
+        fresh.dealExcluding(dead, k, cards, rng);
+        CardSet dealt;
+        for (int i = 0; i < k; ++i) dealt.add(cards[i]);
+        check(dealt == dead.complement(), "dealExcluding all " + std::to_string(k) + " live cards");
+    }
+
+    bool threw = false;
+    try {
+        fresh.dealExcluding(CardSet::fromPokerStoveString("AsAhAdAc"), 49);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    check(threw, "dealExcluding more cards than are live throws");
+}
+
+GameState newHand(const char* hole0, const char* hole1, const char* board, int stack0, int stack1, int blind) {
+    return GameState::newHand(CardSet::fromPokerStoveString(hole0).toHand(),
+                              CardSet::fromPokerStoveString(hole1).toHand(),
+                              CardSet::fromPokerStoveString(board).toCards(), stack0, stack1, blind);
+}
+
+bool sameState(const GameState& a, const GameState& b) {
+    return std::memcmp(&a, &b, sizeof(GameState)) == 0;
+}
+
+void checkGameState() {
+    // Random walks over the legal actions: every apply() is taken back exactly,
+    // and fromState rebuilds the seat and street each action was taken in
+    Rng rng(3);
+    Deck deck(3);
+    for (int walk = 0; walk < 2000; ++walk) {
+        int dealt[9];
+        deck.dealExcluding(CardSet(), 9, dealt, rng);
+        Hand holes[2];
+        std::vector<Card> board;
+        for (int i = 0; i < 4; ++i) holes[i % 2].addCard(Card::fromIndex(dealt[i]));
+        for (int i = 4; i < 9; ++i) board.push_back(Card::fromIndex(dealt[i]));
+        const int stacks[2] = {1 + static_cast<int>(rng.below(2000)), 1 + static_cast<int>(rng.below(2000))};
+        const GameState start = GameState::newHand(holes[0], holes[1], board, stacks[0], stacks[1], 50);
+
+        GameState state = start;
+        int seats[GameState::MAX_ACTIONS], streets[GameState::MAX_ACTIONS];
+        bool undone = true;
+        while (!state.isTerminal()) {
+            const ActionList actions = state.legalActions();
+            const Action action = actions[static_cast<int>(rng.below(static_cast<uint32_t>(actions.size())))];
+            seats[state.numActions()] = state.toAct();
+            streets[state.numActions()] = state.street();
+            const GameState before = state;
+            state.apply(action);
+            GameState back = state;
+            back.undo();
+            undone &= sameState(back, before);
+        }
+        check(undone, "apply then undo restores the state, walk " + std::to_string(walk));
+        check(state.net(0) + state.net(1) == 0, "net sums to zero, walk " + std::to_string(walk));
+
+        const HandRecord record = HandRecord::fromState(state, 1, walk);
+        bool rebuilt = record.numActions == state.numActions();
+        for (int i = 0; rebuilt && i < record.numActions; ++i) {
+            rebuilt = record.actionSeat(i) == seats[i] && record.actionStreet(i) == streets[i] &&
+                      record.action(i).type == state.action(i).type &&
+                      record.action(i).amount == state.action(i).amount;
+        }
+        rebuilt &= record.startingStacks[0] == stacks[0] && record.startingStacks[1] == stacks[1] &&
+                   record.net[0] == state.net(0) && record.phase() == state.phase();
+        check(rebuilt, "fromState rebuilds seats, streets and result, walk " + std::to_string(walk));
+
+        GameState rewound = state;
+        while (rewound.numActions() > 0) rewound.undo();
+        check(sameState(rewound, start), "undoing every action returns to the new hand, walk " + std::to_string(walk));
+    }
+
+    // Payouts at terminal states
+    GameState fold = newHand("AsAh", "7c2d", "KdQs9h4c3s", 1000, 1000, 50);
+    fold.apply({Action::Type::Bet, 100});
+    fold.apply({Action::Type::Fold, 0});
+    check(fold.phase() == GameState::Phase::Folded && fold.net(0) == 50 && fold.net(1) == -50,
+          "a fold gives the pot to the other seat");
+
+    GameState shove = newHand("AsAh", "7c2d", "KdQs9h4c3s", 1000, 300, 50);
+    shove.apply({Action::Type::Bet, 900});
+    shove.apply({Action::Type::Call, 250}); // All in for less
+    check(shove.phase() == GameState::Phase::Showdown && shove.net(0) == 300 && shove.net(1) == -300,
+          "only the matched chips are won at showdown");
+
+    GameState split = newHand("2s3h", "2c3d", "AdKsQhJcTs", 1000, 1000, 50);
+    while (!split.isTerminal()) split.apply({Action::Type::Check, 0});
+    check(split.phase() == GameState::Phase::Showdown && split.net(0) == 0 && split.net(1) == 0,
+          "a board that plays splits the pot");
+}
+
+} // namespace
+
+int main() {
+    checkDeck();
+    checkGameState();
+    std::cout << (failures ? "core FAILED" : "core ok") << std::endl;
+    return failures ? 1 : 0;
+}
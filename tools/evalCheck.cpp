@@ -0,0 +1,121 @@
+// Exhaustive check of the hand evaluator. Enumerates every 5-card hand (with
+// --seven every 7-card hand), compares the count of each category with the
+// known totals, and checks that evaluateBatch agrees with evaluate at every
+// SIMD level this CPU supports. Exits with status 1 on any mismatch.
+//
+// Usage: poker_evalcheck [--seven]
+#include "cardSet.h"
+#include "evaluator.h"
+#include "threadPool.h"
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+const char* const CATEGORY_NAMES[10] = {"high card", "one pair", "two pair", "trips", "straight",
+                                        "flush", "full house", "quads", "straight flush", "royal flush"};
+
+// Hands per category on the Evaluator::handType scale
+constexpr uint64_t FIVE_CARD_COUNTS[10] = {1302540, 1098240, 123552, 54912, 10200,
+                                           5108, 3744, 624, 36, 4};
+constexpr uint64_t SEVEN_CARD_COUNTS[10] = {23294460, 58627800, 31433400, 6461620, 6180020,
+                                            4047644, 3473184, 224848, 37260, 4324};
+
+constexpr size_t BATCH = 4096;
+
+// Calls fn(hands, count) for batches of every numCards-card hand whose lowest card is first
+template <typename Fn>
+void forEachHandFrom(int first, int numCards, Fn&& fn) {
+    std::vector<CardSet> batch;
+    batch.reserve(BATCH);
+    int cards[7];
+    cards[0] = first;
+    // Odometer over the remaining cards, each above the one before
+    for (int i = 1; i < numCards; ++i) cards[i] = first + i;
+    if (cards[numCards - 1] >= 52) return;
+    while (true) {
+        uint64_t mask = 0;
+        for (int i = 0; i < numCards; ++i) mask |= uint64_t(1) << cards[i];
+        batch.push_back(CardSet(mask));
+        if (batch.size() == BATCH) {
+            fn(batch.data(), batch.size());
+            batch.clear();
+        }
+        int i = numCards - 1;
+        while (i > 0 && cards[i] == 52 - numCards + i) --i;
+        if (i == 0) break;
+        ++cards[i];
+        for (int j = i + 1; j < numCards; ++j) cards[j] = cards[j - 1] + 1;
+    }
+    if (!batch.empty()) fn(batch.data(), batch.size());
+}
+
+bool checkCategories(int numCards, const uint64_t expected[10]) {
+    std::mutex mutex;
+    uint64_t counts[10] = {};
+    ThreadPool::shared().parallelFor(52, [&](size_t first) {
+        uint64_t local[10] = {};
+        forEachHandFrom(static_cast<int>(first), numCards, [&](const CardSet* hands, size_t count) {
+            for (size_t i = 0; i < count; ++i) ++local[Evaluator::handType(Evaluator::evaluate(hands[i]))];
+        });
+        std::lock_guard<std::mutex> lock(mutex);
+        for (int c = 0; c < 10; ++c) counts[c] += local[c];
+    });
+
+    bool ok = true;
+    for (int c = 0; c < 10; ++c) {
+        const bool match = counts[c] == expected[c];
+        ok &= match;
+        std::cout << "  " << numCards << "-card " << CATEGORY_NAMES[c] << ": " << counts[c]
+                  << (match ? "" : " MISMATCH, expected ") << (match ? "" : std::to_string(expected[c])) << "\n";
+    }
+    return ok;
+}
+
+bool checkBatch(int numCards, Evaluator::SimdLevel level) {
+    Evaluator::setSimdLevel(level);
+    std::atomic<uint64_t> mismatches{0};
+    ThreadPool::shared().parallelFor(52, [&](size_t first) {
+        std::vector<uint16_t> strengths(BATCH);
+        forEachHandFrom(static_cast<int>(first), numCards, [&](const CardSet* hands, size_t count) {
+            Evaluator::evaluateBatch(hands, count, strengths.data());
+            for (size_t i = 0; i < count; ++i) {
+                if (strengths[i] != Evaluator::evaluate(hands[i])) ++mismatches;
+            }
+        });
+    });
+    std::cout << "  " << numCards << "-card evaluateBatch (" << Evaluator::simdLevelName(level) << "): "
+              << (mismatches ? std::to_string(mismatches) + " MISMATCHES" : std::string("ok")) << "\n";
+    return mismatches == 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    bool seven = false;
+    for (int i = 1; i < argc; ++i) {
+        if (!std::strcmp(argv[i], "--seven")) {
+            seven = true;
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--seven]" << std::endl;
+            return 1;
+        }
+    }
+
+    Evaluator::init();
+    const int numCards = seven ? 7 : 5;
+    bool ok = checkCategories(numCards, seven ? SEVEN_CARD_COUNTS : FIVE_CARD_COUNTS);
+    const Evaluator::SimdLevel detected = Evaluator::detectSimdLevel();
+    for (Evaluator::SimdLevel level : {Evaluator::SimdLevel::Scalar, Evaluator::SimdLevel::AVX2,
+                                       Evaluator::SimdLevel::AVX512}) {
+        if (static_cast<int>(level) <= static_cast<int>(detected)) ok &= checkBatch(numCards, level);
+    }
+    Evaluator::setSimdLevel(detected);
+
+    std::cout << (ok ? "evaluator ok" : "evaluator FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
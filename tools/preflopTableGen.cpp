@@ -0,0 +1,111 @@
+// Generates src/preflopTableData.h: Monte Carlo equity of one holding from
+// each of the 169 starting-hand classes against 1..O random hands, empty board.
+// Heads-up rows get --samples per class, multi-way rows --multiway-samples.
+//
+// Usage: poker_preflop_gen [--samples N] [--multiway-samples M] [--opponents O]
+//                          [--seed S] [--threads T] [--out PATH]
+#include "playerAI.h"
+#include "preflopTable.h"
+#include "rng.h"
+#include "threadPool.h"
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t TABLE_VERSION = 2; // Bump when the generated layout changes
+
+uint16_t toFixed(double probability) {
+    return static_cast<uint16_t>(std::lround(probability * 65535.0));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    uint64_t samples = 4000000;
+    uint64_t multiwaySamples = 250000;
+    int opponents = MAX_OPPONENTS;
+    uint64_t seed = 1;
+    unsigned threads = 0;
+    std::string outPath = "src/preflopTableData.h";
+
+    for (int i = 1; i < argc; ++i) {
+        const bool hasValue = i + 1 < argc;
+        if (!std::strcmp(argv[i], "--samples") && hasValue) samples = std::strtoull(argv[++i], nullptr, 10);
+        else if (!std::strcmp(argv[i], "--multiway-samples") && hasValue) multiwaySamples = std::strtoull(argv[++i], nullptr, 10);
+        else if (!std::strcmp(argv[i], "--opponents") && hasValue) opponents = std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--seed") && hasValue) seed = std::strtoull(argv[++i], nullptr, 10);
+        else if (!std::strcmp(argv[i], "--threads") && hasValue) threads = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        else if (!std::strcmp(argv[i], "--out") && hasValue) outPath = argv[++i];
+        else {
+            std::cerr << "Usage: " << argv[0] << " [--samples N] [--multiway-samples M] [--opponents O]"
+                      << " [--seed S] [--threads T] [--out PATH]" << std::endl;
+            return 1;
+        }
+    }
+    if (opponents < 1 || opponents > MAX_OPPONENTS) {
+        std::cerr << "--opponents must be 1.." << MAX_OPPONENTS << std::endl;
+        return 1;
+    }
+
+    ThreadPool pool(ThreadPool::forCores(threads));
+    playerAI ai(pool);
+    ai.setExactThreshold(0);
+
+    EquityOptions options;
+    options.maxSamples = samples;
+    options.batchSize = 1 << 20; // Stopping checks are pointless here, keep every core busy
+    options.usePreflopTable = false;
+
+    std::vector<uint64_t> rowSamples(opponents);
+    std::vector<std::vector<EquityResult>> results(opponents, std::vector<EquityResult>(PreflopTable::NUM_CLASSES));
+    const auto start = std::chrono::steady_clock::now();
+    for (int row = 0; row < opponents; ++row) {
+        options.opponents = row + 1;
+        options.maxSamples = rowSamples[row] = row == 0 ? samples : multiwaySamples;
+        for (int index = 0; index < PreflopTable::NUM_CLASSES; ++index) {
+            const uint64_t stream = static_cast<uint64_t>(row) * PreflopTable::NUM_CLASSES + index;
+            ai.setSeed(Rng::forStream(seed, stream).next() | 1); // nonzero: fixed seed per class and row
+            results[row][index] = ai.evaluateEquity(PreflopTable::representative(index).toHand(), {}, options);
+            std::cerr << "\r" << row + 1 << " opp " << index + 1 << "/" << PreflopTable::NUM_CLASSES << " "
+                      << PreflopTable::className(index) << "   " << std::flush;
+        }
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cerr << "\nDone in " << seconds << " s" << std::endl;
+
+    std::ofstream out(outPath);
+    if (!out) {
+        std::cerr << "Cannot write " << outPath << std::endl;
+        return 1;
+    }
+    out << "// Generated by poker_preflop_gen (tools/preflopTableGen.cpp). Do not edit by hand.\n"
+        << "// " << samples << " heads-up / " << multiwaySamples << " multi-way samples per class, seed " << seed << ".\n"
+        << "#pragma once\n"
+        << "#include <cstdint>\n\n"
+        << "constexpr uint32_t PREFLOP_TABLE_VERSION = " << TABLE_VERSION << ";\n"
+        << "constexpr int PREFLOP_TABLE_OPPONENTS = " << opponents << ";\n"
+        << "constexpr uint64_t PREFLOP_TABLE_SAMPLES[PREFLOP_TABLE_OPPONENTS] = {";
+    for (int row = 0; row < opponents; ++row) out << (row ? ", " : "") << rowSamples[row];
+    out << "};\n\n"
+        << "// {win, tie, tieShare} in units of 1/65535, indexed [opponents - 1][PreflopTable::classIndex]\n"
+        << "constexpr uint16_t PREFLOP_TABLE[PREFLOP_TABLE_OPPONENTS][169][3] = {\n";
+    for (int row = 0; row < opponents; ++row) {
+        out << "    { // " << row + 1 << (row ? " opponents" : " opponent") << "\n";
+        for (int index = 0; index < PreflopTable::NUM_CLASSES; ++index) {
+            const EquityResult& r = results[row][index];
+            out << "        {" << toFixed(r.win) << ", " << toFixed(r.tie) << ", " << toFixed(r.tieShare) << "}"
+                << (index + 1 < PreflopTable::NUM_CLASSES ? "," : " ") << " // " << PreflopTable::className(index) << "\n";
+        }
+        out << (row + 1 < opponents ? "    },\n" : "    }\n");
+    }
+    out << "};\n";
+    std::cerr << "Wrote " << outPath << std::endl;
+    return 0;
+}